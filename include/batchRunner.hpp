@@ -0,0 +1,97 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    batchRunner.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Runs many small biotopes in one process without any window.
+ *
+ * This program part is made for Monte-Carlo studies. For every live rate a number of random biotopes is created and
+ * each one lives until it is extinct, repeats itself or reaches the maximum number of generations. The biotopes are
+ * independent, so they are spread over the worker threads and stepped single threaded.
+ *
+ * If there is a fixed life cycle for the size and the rule (see fixedLifeCycle.hpp), the biotopes are seeded by a
+ * LifeCycle and stepped by the fixed one, which does not need any of the tiles, ages or monitors of the LifeCycle.
+ * With EnableMultiverse(), up to 256 biotopes per thread are stepped together bit-sliced (see multiverse.hpp).
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_BATCHRUNNER_HPP_AP_19102026
+#define HEADER_BATCHRUNNER_HPP_AP_19102026
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace GameOfLife
+{
+    class LifeCycle;
+    class FixedBoard;
+    class Multiverse;
+    struct struct_cycle;
+
+    enum batch_stop
+    {
+        extinct,
+        stabilized,
+        generation_limit
+    };
+
+    struct struct_batch_result
+    {
+        int live_rate;
+        unsigned seed;
+        batch_stop reason;
+        uint64_t initial_population, final_population;
+        uint64_t generations, period, onset;
+    };
+
+/** @class BatchRunner
+ *  @brief Runs many small biotopes in one process without any window.
+ */
+class BatchRunner
+{
+public:
+        BatchRunner(int rows, int columns, int runs_per_rate, int live_rate_min, int live_rate_max, int live_rate_step,
+                    std::string rule);
+        virtual ~BatchRunner();				// Virtual Destructor.
+
+        // Steps so many biotopes per thread together as universes of a multiverse, 0 steps them one by one.
+        void EnableMultiverse(int universes);
+
+        void Run(int threads, int max_generations, int cycle_window, unsigned first_seed);
+        void Report(std::string output_file);
+
+        std::vector<struct_batch_result> results;
+
+private:
+        void RunUniverse(struct_batch_result &result, int worker, int max_generations, int cycle_window);
+        void RunFixedUniverse(struct_batch_result &result, int worker, int max_generations, int cycle_window);
+        void RunMultiverse(std::atomic<int> &next, std::atomic<int> &finished, int worker, int max_generations,
+                           int cycle_window);
+        void Progress(std::atomic<int> &finished, int worker);
+        static void Finish(struct_batch_result &result, uint64_t population, uint64_t generation,
+                           const struct_cycle &cycle);
+
+        int _rows, _columns, _runs_per_rate;
+        std::vector<int> _live_rates;
+        std::string _rule;
+        bool _fixed;
+        int _multiverse_universes;
+
+        // One life cycle per worker, which is restarted for every biotope instead of allocated again. With a fixed
+        // life cycle, the life cycle only seeds the biotopes.
+        std::vector<std::unique_ptr<LifeCycle>> _universes;
+        std::vector<std::unique_ptr<FixedBoard>> _fixed_universes;
+        std::vector<std::unique_ptr<Multiverse>> _multiverses;
+};
+}
+
+#endif // HEADER_BATCHRUNNER_HPP_AP_19102026
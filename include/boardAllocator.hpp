@@ -0,0 +1,78 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    boardAllocator.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Memory for the large buffers: the tiles of the biotope, the outer halo and the buffers of the renderer.
+ *
+ * Every buffer starts at a cache line. Buffers of 2 MB and more are mapped directly and aligned to 2 MB, so they can
+ * be backed by huge pages: a sweep over a large biotope touches one TLB entry per 2 MB instead of one per 4 kB. The
+ * huge pages are either transparent (madvise) or explicit (MAP_HUGETLB, from the pool of the kernel, see
+ * /proc/sys/vm/nr_hugepages). Without free explicit huge pages the transparent ones are used.
+ *
+ * The elements are not initialized. Mapped memory is zero and is only placed on a NUMA node, when a thread writes it
+ * first.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_BOARDALLOCATOR_HPP_AP_19102026
+#define HEADER_BOARDALLOCATOR_HPP_AP_19102026
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace GameOfLife
+{
+    static constexpr size_t cache_line_size = 64;
+    static constexpr size_t huge_page_size = 2 << 20;
+
+    enum huge_page_mode
+    {
+        no_huge_pages,              // Only pages of 4 kB, also if the kernel would use huge pages on its own.
+        transparent_huge_pages,     // The kernel backs the mapped buffers with huge pages, as far as it can.
+        explicit_huge_pages         // Huge pages of the pool of the kernel.
+    };
+
+    // Mode for the buffers allocated from now on: none, transparent or explicit.
+    void SetHugePages(std::string mode);
+    huge_page_mode HugePages();
+
+    void *AllocateBoard(size_t bytes);
+    void FreeBoard(void *memory, size_t bytes);
+
+    // Allocator of the large buffers for std::vector.
+    template<class T>
+    struct BoardAllocator
+    {
+        typedef T value_type;
+
+        BoardAllocator() = default;
+        template<class U> BoardAllocator(const BoardAllocator<U> &) {}
+
+        T *allocate(size_t count) { return (T *) AllocateBoard(count * sizeof(T)); }
+        void deallocate(T *pointer, size_t count) { FreeBoard(pointer, count * sizeof(T)); }
+
+        template<class U> void construct(U *pointer) { ::new((void *) pointer) U; }
+
+        template<class U, class... Args> void construct(U *pointer, Args &&... args)
+        {
+            ::new((void *) pointer) U(std::forward<Args>(args)...);
+        }
+
+        template<class U> bool operator==(const BoardAllocator<U> &) const { return true; }
+        template<class U> bool operator!=(const BoardAllocator<U> &) const { return false; }
+    };
+
+    template<class T>
+    using board_vector = std::vector<T, BoardAllocator<T>>;
+}
+
+#endif // HEADER_BOARDALLOCATOR_HPP_AP_19102026
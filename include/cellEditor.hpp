@@ -0,0 +1,77 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    cellEditor.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Painting of individuals and stamping of patterns with the mouse.
+ *
+ * Left mouse button: paint living individuals, right mouse button: erase them. S stamps the loaded pattern at the
+ * cursor, R turns the pattern by 90 degrees. The edits are only queued while the events are handled and applied as
+ * one batch between two generations, so only the touched tiles become active and are drawn again.
+ *
+ * Patterns are read in the run length encoded format (.rle) or in the plain text format (.cells) of the LifeWiki.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CELLEDITOR_HPP_AP_19102026
+#define HEADER_CELLEDITOR_HPP_AP_19102026
+
+#include <SFML/Graphics.hpp>
+#include <string>
+#include <vector>
+
+#include "lifeCycle.hpp"
+
+
+namespace GameOfLife
+{
+    class Visual2D;
+
+    struct struct_pattern
+    {
+        std::string name;
+        int rows, columns;
+        std::vector<uint8_t> cells;     // Row by row, 1 for a living individual.
+    };
+
+    bool LoadPattern(std::string path, struct_pattern &pattern);
+
+/** @class CellEditor
+ *  @brief Collects the edits of the user and applies them to the life cycle.
+ */
+class CellEditor
+{
+public:
+        CellEditor(std::string pattern_file);
+        virtual ~CellEditor();				// Virtual Destructor.
+
+        // True, if the event was an edit. All other events belong to the camera.
+        bool HandleEvent(const sf::Event &event, const Visual2D &visualization);
+        void Apply(LifeCycle &lifecycle);
+
+        // Hands all queued edits over, e.g. to the stepping thread of the frame pipeline.
+        std::vector<struct_cell_change> TakeEdits();
+
+        size_t Pending() const { return _queue.size(); }
+
+private:
+        void PaintLine(int row0, int column0, int row1, int column1, bool alive);
+        void Stamp(int row, int column);
+        void Rotate();
+
+        struct_pattern _pattern;
+        std::vector<struct_cell_change> _queue;
+
+        // Stroke of the pressed button. Fast mouse moves are connected by lines.
+        bool _painting, _alive;
+        int _last_row, _last_column;
+        int _mouse_x, _mouse_y;
+};
+}
+
+#endif // HEADER_CELLEDITOR_HPP_AP_19102026
@@ -0,0 +1,165 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    census.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Census of the objects in the biotope: still lifes, oscillators and spaceships.
+ *
+ * An object is a cluster of living individuals, in which at most one dead individual lies between two neighbours
+ * (horizontally, vertically or diagonally). Objects this close influence each other, and some oscillators and
+ * spaceships fall apart in some phases with a closer neighbourhood (e.g. the lightweight spaceship). Still lifes this
+ * close to each other are counted as one pseudo still life. The census works on runs of living individuals in a row
+ * instead of single individuals:
+ *
+ * 1. Every tile row (band of 64 board rows) extracts its runs from the tile words.
+ * 2. Every band joins its runs with the close runs of the same row and of the two rows above, also of the band
+ *    above. The union-find over all runs is lock-free, so the bands can be joined in parallel.
+ * 3. The objects are cut out, turned into the smallest of their 8 symmetric forms (rotations and reflections) and
+ *    counted in a concurrent hash table keyed by the hash of this canonical form.
+ * 4. Each distinct form runs on its own for a few generations. It is a still life, an oscillator or a spaceship, if
+ *    it comes back. The phases of an oscillator or spaceship are counted as one object.
+ *
+ * Objects, which still influence each other over a larger distance, and objects, which are not settled yet, do not
+ * come back on their own and are counted as "other". Known objects get their usual name, the others a name like
+ * "xs14_3f09a2c1" (still life with 14 individuals), "xp2_..." (oscillator) or "xq4_..." (spaceship) after the
+ * prefixes of apgsearch.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CENSUS_HPP_AP_19102026
+#define HEADER_CENSUS_HPP_AP_19102026
+
+#include <stdio.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace GameOfLife
+{
+    class LifeCycle;
+    class WorkerPool;
+
+    // One kind of object in the census.
+    struct struct_census_entry
+    {
+        std::string name;
+        std::string kind;       // still_life, oscillator, spaceship, other or oversized
+        int period;             // 0 if the object does not come back
+        int cells;              // Living individuals of the canonical phase (the mean for oversized objects)
+        uint64_t key;           // Hash of the canonical form, the same for all phases
+        uint64_t count;
+    };
+
+/** @class ObjectCensus
+ *  @brief Labels, classifies and counts the objects of one generation.
+ */
+class ObjectCensus
+{
+public:
+        ObjectCensus(bool verbose = true);
+        virtual ~ObjectCensus();				// Virtual Destructor.
+
+        // Counts the objects of the current generation. Without a pool the census runs in the calling thread.
+        void Take(const LifeCycle &lifecycle, WorkerPool *pool);
+
+        // Appends the entries of the last census to a CSV file, one line per kind of object.
+        void OpenFile(std::string path);
+        void Write();
+        void Report(int lines) const;
+
+        // Kinds of the last census, the most frequent first.
+        const std::vector<struct_census_entry> &Entries() const { return _entries; }
+        uint64_t Objects() const { return _objects; }
+        uint64_t Generation() const { return _generation; }
+
+        // Objects up to this edge length are classified, larger ones are only counted.
+        static constexpr int classify_size = 32;
+        static constexpr int max_period = 30;
+        static constexpr size_t max_classes = 1 << 20;
+
+private:
+        // Living individuals [begin, end) of one board row.
+        struct struct_census_run
+        {
+            int row, begin, end;
+        };
+
+        // Runs of one tile row, run_start[r] is the first run of row r of the band.
+        struct struct_census_band
+        {
+            std::vector<struct_census_run> runs;
+            std::vector<int> run_start;
+            uint32_t offset;
+        };
+
+        // Object cut out of the board, bit c of rows[r] is the individual in column c. At most 64 x 64.
+        struct struct_census_shape
+        {
+            int height, width;
+            std::vector<uint64_t> rows;
+        };
+
+        struct struct_census_slot
+        {
+            std::atomic<uint64_t> key;
+            std::atomic<uint64_t> count;
+        };
+
+        struct struct_census_class
+        {
+            std::string kind;
+            int period, cells;
+            uint64_t key;
+        };
+
+        void ExtractRuns(const LifeCycle &lifecycle, int band);
+        void JoinRuns(int band);
+        void JoinRows(const struct_census_run *above, int above_count, uint32_t above_offset,
+                      const struct_census_run *below, int below_count, uint32_t below_offset);
+        uint32_t Find(uint32_t run);
+        void Union(uint32_t a, uint32_t b);
+        void CountObject(int object, int worker);
+        void Insert(uint64_t key, const struct_census_shape &shape);
+        struct_census_class Classify(const struct_census_shape &shape) const;
+        std::string Name(const struct_census_class &object) const;
+
+        bool _verbose;
+        FILE *_file;
+
+        // Buffers of the labelling, kept between two censuses.
+        std::vector<struct_census_band> _bands;
+        std::unique_ptr<std::atomic<uint32_t>[]> _parent;
+        size_t _parent_capacity;
+        std::vector<uint32_t> _object_of_run, _object_start;
+        std::vector<struct_census_run> _object_runs;
+
+        // Three shapes per worker: the object, the best and the current symmetric form.
+        std::vector<struct_census_shape> _scratch;
+
+        // Concurrent hash table of the canonical forms.
+        std::unique_ptr<struct_census_slot[]> _slots;
+        std::vector<struct_census_shape> _slot_shapes;
+        size_t _slot_capacity;
+        std::atomic<uint64_t> _oversized, _oversized_cells;
+
+        // Class of every canonical form seen so far.
+        std::unordered_map<uint64_t, struct_census_class> _classes;
+
+        // Canonical keys of the known objects.
+        std::unordered_map<uint64_t, std::string> _names;
+
+        std::vector<struct_census_entry> _entries;
+        uint64_t _objects, _generation;
+};
+}
+
+#endif // HEADER_CENSUS_HPP_AP_19102026
@@ -0,0 +1,167 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    controlServer.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Remote control of the life cycle over a local socket.
+ *
+ * Other programs connect to a Unix socket ("unix:/tmp/game_of_life.sock") or to a TCP port on the loopback interface
+ * ("tcp:5555"). Every message starts with a struct_control_header and is followed by "length" bytes of payload. All
+ * numbers are in the byte order of the host, the socket is local anyway.
+ *
+ * Commands:
+ *   control_pause        -                                   stops the free running life cycle
+ *   control_resume       -                                   lets the life cycle run again
+ *   control_step         uint32 generations                  steps and pauses, replies with a status when done
+ *   control_set_cells    uint32 count, count x struct_cell_edit
+ *   control_get_region   int32 row, column, height, width    replies with reply_region
+ *   control_subscribe    -                                   replies with a key frame, then one delta per generation
+ *   control_unsubscribe  -
+ *   control_status       -                                   replies with reply_status
+ *
+ * All other commands are answered with a reply_status as well, a failed command with a reply_error.
+ *
+ * Replies:
+ *   reply_status         struct_control_status
+ *   reply_region         uint64 generation, int32 row, column, height, width, then height rows of
+ *                        (width + 63) / 64 words. Bit c of word w is the individual in column (column + 64 w + c).
+ *   reply_delta          struct_delta_header, then per tile: int32 tile_row, tile_column, uint32 code_length and the
+ *                        code of the XOR of the tile rows with their last sent state (see deltaCodec.hpp). A key frame
+ *                        is the XOR with an empty biotope and contains only tiles with life.
+ *   reply_error          text
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CONTROLSERVER_HPP_AP_19102026
+#define HEADER_CONTROLSERVER_HPP_AP_19102026
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "lifeCycle.hpp"
+
+
+namespace GameOfLife
+{
+    enum control_message : uint8_t
+    {
+        control_pause = 1,
+        control_resume = 2,
+        control_step = 3,
+        control_set_cells = 4,
+        control_get_region = 5,
+        control_subscribe = 6,
+        control_unsubscribe = 7,
+        control_status = 8,
+
+        reply_status = 0x81,
+        reply_region = 0x82,
+        reply_delta = 0x83,
+        reply_error = 0x8F
+    };
+
+    struct struct_control_header
+    {
+        uint8_t type;
+        uint8_t reserved[3];
+        uint32_t length;            // Bytes of payload after the header.
+    };
+
+    struct struct_cell_edit
+    {
+        int32_t row, column;
+        uint8_t alive;
+        uint8_t reserved[3];
+    };
+
+    struct struct_control_status
+    {
+        uint64_t generation, population, hash;
+        int32_t rows, columns;
+        uint8_t paused, halted;
+        uint8_t reserved[6];
+    };
+
+    struct struct_delta_header
+    {
+        uint64_t generation, population;
+        uint32_t tiles;             // Number of tiles in the message.
+        uint32_t key_frame;         // 1, if the tiles are XORed with an empty biotope.
+    };
+
+/** @class ControlServer
+ *  @brief Remote control of the life cycle over a local socket.
+ *
+ *  The server never blocks: Poll() handles whatever is waiting on the sockets (epoll with a timeout of zero) and
+ *  returns. Long step commands are spread over several calls. Subscribers, which do not read their deltas, are
+ *  disconnected once their output exceeds a limit, so a slow client cannot stall the simulation.
+ */
+class ControlServer
+{
+public:
+        ControlServer(std::string address, bool paused);
+        virtual ~ControlServer();				// Virtual Destructor.
+
+        bool IsOpen() const { return _epoll >= 0; }
+
+        // True, if the caller shall step the life cycle on its own.
+        bool Running() const { return !_paused && _step_jobs.empty(); }
+
+        void Poll(LifeCycle &lifecycle);
+        void Broadcast(const LifeCycle &lifecycle);
+
+private:
+        struct struct_client
+        {
+            int socket;
+            std::vector<uint8_t> input, output;
+            size_t output_offset;
+            bool subscribed;
+            bool writing;           // Registered for EPOLLOUT.
+        };
+
+        struct struct_step_job
+        {
+            int socket;
+            uint32_t generations;
+        };
+
+        void Accept();
+        void Receive(struct_client &client, LifeCycle &lifecycle);
+        void Execute(struct_client &client, uint8_t type, const uint8_t *payload, uint32_t length,
+                     LifeCycle &lifecycle);
+        void RunStepJobs(LifeCycle &lifecycle);
+        void Send(struct_client &client, uint8_t type, const void *payload, size_t length);
+        void SendStatus(struct_client &client, const LifeCycle &lifecycle);
+        void SendRegion(struct_client &client, const LifeCycle &lifecycle, const int32_t *region);
+        void SendKeyFrame(struct_client &client, const LifeCycle &lifecycle);
+        void Flush(struct_client &client);
+        void Disconnect(int socket);
+
+        std::string _unix_path;
+        int _listen, _epoll;
+        bool _paused;
+
+        std::unordered_map<int, struct_client> _clients;
+        std::deque<struct_step_job> _step_jobs;
+
+        // State of the biotope, which the subscribers know.
+        std::vector<uint64_t> _shadow;
+        uint64_t _sent_stamp, _sent_generation;
+        int _subscribers;
+
+        std::vector<int> _slots;
+        std::vector<uint8_t> _message;
+        std::vector<struct_cell_change> _changes;
+};
+}
+
+#endif // HEADER_CONTROLSERVER_HPP_AP_19102026
@@ -0,0 +1,57 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    cycleDetector.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Detection of still lifes and oscillating biotopes.
+ *
+ * This program part remembers the hashes of the last generations. As soon as the hash of a new generation was already
+ * seen, the biotope repeats itself and the period and the first generation of the cycle are known.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_CYCLEDETECTOR_HPP_AP_19102026
+#define HEADER_CYCLEDETECTOR_HPP_AP_19102026
+
+#include <cstdint>
+#include <vector>
+
+
+namespace GameOfLife
+{
+    struct struct_cycle
+    {
+        bool detected;
+        uint64_t period;            // 1 for a still life (or an extinct biotope), 2 for a blinker soup, ...
+        uint64_t onset;             // First generation of the cycle.
+    };
+
+/** @class CycleDetector
+ *  @brief Detection of still lifes and oscillating biotopes.
+ *
+ *  The hashes are stored in a ring buffer, so periods up to the window size can be found.
+ */
+class CycleDetector
+{
+public:
+        CycleDetector(int window);
+        virtual ~CycleDetector();				// Virtual Destructor.
+
+        bool Update(uint64_t generation, uint64_t hash);
+        void Reset();
+
+        struct_cycle cycle;
+
+private:
+        int _window, _count;
+        uint64_t _last_generation;
+        std::vector<uint64_t> _hashes;
+};
+}
+
+#endif // HEADER_CYCLEDETECTOR_HPP_AP_19102026
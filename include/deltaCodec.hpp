@@ -0,0 +1,40 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    deltaCodec.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Run length code for the 64 rows of one tile.
+ *
+ * The rows are usually the XOR of two generations of a tile, so most of them are zero and the others have only a
+ * few bits set. The code is a sequence of tokens. A token byte below 0x80 stands for (token + 1) zero rows. A token
+ * byte of 0x80 or above is followed by (token - 0x80 + 1) literal rows. A literal row is a mask byte and the bytes of
+ * the row, which are not zero: bit b of the mask stands for byte b of the row (bits 8 b ... 8 b + 7).
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_DELTACODEC_HPP_AP_19102026
+#define HEADER_DELTACODEC_HPP_AP_19102026
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+namespace GameOfLife
+{
+    // Appends the code of the 64 rows to the end of "code".
+    void EncodeTileRows(const uint64_t *rows, std::vector<uint8_t> &code);
+
+    // Decodes the 64 rows and returns the number of bytes used. Returns 0 for a broken code.
+    size_t DecodeTileRows(const uint8_t *code, size_t size, uint64_t *rows);
+
+    // Decodes only the given row. Returns 0 for a broken code.
+    uint64_t DecodeTileRow(const uint8_t *code, size_t size, int row);
+}
+
+#endif // HEADER_DELTACODEC_HPP_AP_19102026
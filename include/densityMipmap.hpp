@@ -0,0 +1,75 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    densityMipmap.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Population density of the biotope in several levels of detail.
+ *
+ * Level l holds the density of blocks of 2^l x 2^l individuals as value between 0 (empty) and 255 (full). If the view
+ * is zoomed out, one pixel of the screen shows one value of a coarse level instead of many single individuals. Only
+ * the blocks above changed tiles are recalculated.
+ *
+ * If the life cycle keeps the ages of the individuals, a second pyramid holds the heat of every block: 256 minus the
+ * age of the youngest individual in it, 0 for an empty block. So a single birth keeps a whole block hot.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_DENSITYMIPMAP_HPP_AP_19102026
+#define HEADER_DENSITYMIPMAP_HPP_AP_19102026
+
+#include <cstdint>
+#include <vector>
+
+#include "boardAllocator.hpp"
+#include "lifeCycle.hpp"
+
+
+namespace GameOfLife
+{
+/** @class DensityMipmap
+ *  @brief Population density of the biotope in several levels of detail.
+ *
+ *  Level 0 is the biotope itself and is not stored here. Level 1 up to level 6 lie completely inside of one tile,
+ *  the coarser levels are built out of the tile level 6.
+ */
+class DensityMipmap
+{
+public:
+        DensityMipmap();
+        virtual ~DensityMipmap();				// Virtual Destructor.
+
+        void Rebuild(const LifeCycle &lifecycle);
+        void Update(const LifeCycle &lifecycle, const std::vector<int> &slots);
+
+        inline uint8_t Density(int level, int row, int column) const
+        {
+            return _levels[level][(size_t) row * _columns[level] + column];
+        }
+
+        inline uint8_t Heat(int level, int row, int column) const
+        {
+            return _heat[level][(size_t) row * _columns[level] + column];
+        }
+
+        bool HasHeat() const { return !_heat.empty(); }
+
+        int Levels() const { return (int) _levels.size() - 1; }
+        int LevelRows(int level) const { return _rows[level]; }
+        int LevelColumns(int level) const { return _columns[level]; }
+
+private:
+        void UpdateTile(const LifeCycle &lifecycle, int slot);
+        void UpdateBlock(int level, int row, int column);
+
+        // Index 0 stays empty, so that the index is the level.
+        std::vector<board_vector<uint8_t>> _levels, _heat;
+        std::vector<int> _rows, _columns;
+};
+}
+
+#endif // HEADER_DENSITYMIPMAP_HPP_AP_19102026
@@ -0,0 +1,134 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    domainDecomposition.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Distribution of one biotope over several processes.
+ *
+ * The board is split into a grid of blocks along the tile borders, every block is a life cycle in its own process
+ * (rank). In each generation a rank sends its border rows, columns and corner cells to its eight neighbours and
+ * receives theirs into the outer halo of its life cycle. While the halo is on its way, the rank steps its interior
+ * tiles, only the border tiles wait for the halo.
+ *
+ * The ranks are connected by pairs of local sockets, so the memory of the biotope is spread over the processes and
+ * each process only holds its block. The coordinator (the process with the window) never holds the whole biotope,
+ * it gathers a downsampled view: an individual of the view is alive, if any individual of its view_factor x
+ * view_factor block is alive.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_DOMAINDECOMPOSITION_HPP_AP_19102026
+#define HEADER_DOMAINDECOMPOSITION_HPP_AP_19102026
+
+#include <sys/types.h>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+
+namespace GameOfLife
+{
+    class LifeCycle;
+
+    struct struct_block
+    {
+        int rank, block_row, block_column;
+        int row0, column0;          // Position of the upper left individual on the whole board.
+        int rows, columns;
+        int neighbours[8];          // Ranks of the neighbour blocks in the order of struct_tile, -1 outside.
+    };
+
+    enum rank_command : uint32_t
+    {
+        rank_step = 1,
+        rank_gather = 2,
+        rank_quit = 3
+    };
+
+    struct struct_rank_command
+    {
+        uint32_t type;
+        uint32_t generations;
+    };
+
+    // Reply to rank_gather, followed by rows x words_per_row words of the downsampled block.
+    struct struct_rank_view
+    {
+        uint64_t generation, population;
+        uint32_t rows, words_per_row;
+    };
+
+/** @class DomainRank
+ *  @brief One block of the biotope in its own process.
+ */
+class DomainRank
+{
+public:
+        DomainRank(const struct_block &block, int control, const int *links, int view_factor);
+        virtual ~DomainRank();				// Virtual Destructor.
+
+        void Run(std::function<void(LifeCycle &lifecycle, const struct_block &block)> initializer);
+
+private:
+        struct struct_link
+        {
+            int socket;
+            std::vector<uint64_t> send, receive;
+            size_t sent, received;              // In bytes.
+        };
+
+        bool StepGeneration(LifeCycle &lifecycle);
+        void PackBorders(const LifeCycle &lifecycle);
+        bool StartExchange();
+        bool FinishExchange(LifeCycle &lifecycle);
+        bool SendView(const LifeCycle &lifecycle);
+
+        struct_block _block;
+        int _control, _view_factor;
+        struct_link _links[8];
+};
+
+/** @class DomainDecomposition
+ *  @brief Starts the ranks and drives them from the coordinator.
+ */
+class DomainDecomposition
+{
+public:
+        DomainDecomposition(int rows, int columns, int ranks, int view_factor);
+        virtual ~DomainDecomposition();				// Virtual Destructor.
+
+        bool Start(std::function<void(LifeCycle &lifecycle, const struct_block &block)> initializer);
+        bool Step(int generations);
+        bool Gather(LifeCycle &view);
+
+        int ViewRows() const { return (_rows + _view_factor - 1) / _view_factor; }
+        int ViewColumns() const { return (_columns + _view_factor - 1) / _view_factor; }
+        uint64_t Population() const { return _population; }
+        uint64_t Generation() const { return _generation; }
+
+        const std::vector<struct_block> &Blocks() const { return _blocks; }
+
+private:
+        void Stop();
+
+        int _rows, _columns, _view_factor;
+        int _ranks_y, _ranks_x;
+        std::vector<struct_block> _blocks;
+
+        std::vector<int> _control;
+        std::vector<pid_t> _pids;
+        bool _running;
+
+        uint64_t _population, _generation;
+
+        // Bits of the view, row by row, and the same in the tile order of the view life cycle.
+        std::vector<uint64_t> _view_rows, _view_tiles, _block_view;
+};
+}
+
+#endif // HEADER_DOMAINDECOMPOSITION_HPP_AP_19102026
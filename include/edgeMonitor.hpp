@@ -0,0 +1,96 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    edgeMonitor.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Removal of spaceships, which leave the biotope.
+ *
+ * The biotope ends at its border, the individuals outside are always dead. A glider, which flies into the border,
+ * does not disappear but turns into a block or other debris, and a lightweight spaceship leaves even more junk. The
+ * debris pollutes the statistics and can keep a biotope from ever settling down.
+ *
+ * The monitor looks at the individuals within a margin of the border, but only in the border tiles, which changed in
+ * the last generation. A cluster of individuals there is an escaping spaceship, if
+ * - its shape is one phase of a glider or of a light, middle or heavy weight spaceship in a known orientation,
+ * - the spaceship flies towards the border, which is within the margin,
+ * - and nothing else lies in its way to the border or close enough to touch it on the way.
+ * Escaping spaceships are removed and counted as emitted objects.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_EDGEMONITOR_HPP_AP_19102026
+#define HEADER_EDGEMONITOR_HPP_AP_19102026
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "lifeCycle.hpp"
+
+
+namespace GameOfLife
+{
+/** @class EdgeMonitor
+ *  @brief Finds spaceships at the border of the biotope, which fly outwards, and removes them.
+ */
+class EdgeMonitor
+{
+public:
+        EdgeMonitor(int margin, int rows, int columns);
+        virtual ~EdgeMonitor();				// Virtual Destructor.
+
+        // Called after every generation. The removal is one batch of edits.
+        void Check(LifeCycle &lifecycle);
+
+        uint64_t Emitted() const { return _emitted; }
+
+        // Like "12 spaceships left the biotope (glider: 11, lwss: 1)".
+        std::string Describe() const;
+
+        // Largest edge length of a spaceship phase, which is recognized.
+        static constexpr int max_ship_size = 8;
+
+private:
+        // One phase of a spaceship in one orientation. The direction is the movement per period.
+        struct struct_ship_phase
+        {
+            int ship;
+            int height, width;
+            std::vector<uint64_t> rows;
+            int direction_row, direction_column;
+        };
+
+        void AddShip(std::string name, std::string pattern);
+        int BandIndex(int row, int column) const;
+        void Inspect(LifeCycle &lifecycle, int row, int column);
+        bool PathIsClear(const LifeCycle &lifecycle, int top, int bottom, int left, int right,
+                         const struct_ship_phase &phase, bool north, bool south, bool west, bool east) const;
+
+        int _margin;
+
+        // Phases keyed by their shape, see the hash in edgeMonitor.cpp.
+        std::unordered_multimap<uint64_t, struct_ship_phase> _phases;
+        std::vector<std::string> _ship_names;
+        std::vector<uint64_t> _ship_counts;
+        uint64_t _emitted;
+
+        // Band along the border, which a cluster starting within the margin can reach before it is too large:
+        // full rows in the north and south, a few columns in the west and east in between. See BandIndex().
+        int _rows, _columns, _band_north, _band_south, _band_west, _band_east;
+
+        // Buffers of one check. _visited has one byte per individual of the band.
+        std::vector<uint8_t> _visited;
+        bool _visited_dirty;
+        std::vector<std::pair<int, int>> _cluster, _stack;
+        std::vector<uint64_t> _shape;
+        std::vector<struct_cell_change> _removals;
+};
+}
+
+#endif // HEADER_EDGEMONITOR_HPP_AP_19102026
@@ -0,0 +1,73 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    engineSelector.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Choice of the step mode from the measured state of the biotope.
+ *
+ * Every "interval" generations the life cycle hands over a sample with the density and the churn of the biotope.
+ * A dense soup, which keeps nearly every tile busy, is stepped fastest as a full sweep without any bookkeeping. As
+ * soon as the activity has settled down to some regions, only the active tiles are stepped. The thresholds for the
+ * two directions differ and a new mode is kept for a few intervals, so a biotope near a threshold does not flap
+ * between the modes.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_ENGINESELECTOR_HPP_AP_19102026
+#define HEADER_ENGINESELECTOR_HPP_AP_19102026
+
+#include <stdio.h>
+#include <cstdint>
+#include <string>
+
+#include "lifeCycle.hpp"
+
+
+namespace GameOfLife
+{
+    struct struct_engine_sample
+    {
+        uint64_t generation, population;
+        double density;                 // Living individuals per individual of the board.
+        double active_fraction;         // Tiles, which changed or have a changed neighbour, per tile.
+        double stepped_fraction;        // Tiles, which were stepped, per tile (average over the interval).
+        double churn;                   // Changed tiles per tile (average over the interval).
+        double generations_per_second;
+    };
+
+/** @class EngineSelector
+ *  @brief Choice of the step mode from the measured state of the biotope.
+ *
+ *  With a stats file every sample is written as one CSV line, also without the adaptive mode.
+ */
+class EngineSelector
+{
+public:
+        EngineSelector(bool verbose);
+        virtual ~EngineSelector();				// Virtual Destructor.
+
+        void SetAdaptive(bool adaptive) { this->_adaptive = adaptive; }
+        void SetInterval(int interval) { this->_interval = interval < 1 ? 1 : interval; }
+        void OpenStats(std::string path);
+
+        bool Adaptive() const { return _adaptive; }
+        int Interval() const { return _interval; }
+        uint64_t Switches() const { return _switches; }
+
+        step_mode Select(const struct_engine_sample &sample, step_mode current);
+
+private:
+        bool _adaptive, _verbose;
+        int _interval, _intervals_since_switch;
+        uint64_t _switches;
+
+        FILE *_stats;
+};
+}
+
+#endif // HEADER_ENGINESELECTOR_HPP_AP_19102026
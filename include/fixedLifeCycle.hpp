@@ -0,0 +1,286 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    fixedLifeCycle.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Life cycle with the size of the biotope and the rule fixed at compile time.
+ *
+ * Production runs use a few fixed sizes. With rows, columns and rule as template parameters, every loop bound, the
+ * row stride and the rule are constants: the compiler unrolls the words of a row, drops the masks of partial tiles
+ * and keeps only the neighbour counts, which the rule uses. The biotope is stored row by row, one bit per
+ * individual, every row starts at a cache line.
+ *
+ * The common sizes are instantiated in fixedLifeCycle.cpp. CreateFixedLifeCycle() picks the instantiation for a
+ * size and rule given at runtime and returns nothing for all others, then the generic LifeCycle has to be used.
+ * The batch mode (see batchRunner.hpp) steps its biotopes with it, whenever there is one for their size and rule. The
+ * window stays with the LifeCycle, it needs the tiles, the ages, the census and the edge monitor.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_FIXEDLIFECYCLE_HPP_AP_19102026
+#define HEADER_FIXEDLIFECYCLE_HPP_AP_19102026
+
+#include <string.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "boardAllocator.hpp"
+#include "lifeCycle.hpp"
+#include "lifeRule.hpp"
+#include "workerPool.hpp"
+
+
+namespace GameOfLife
+{
+/** @class FixedBoard
+ *  @brief Runtime interface of all instantiations of FixedLifeCycle.
+ */
+class FixedBoard
+{
+public:
+        virtual ~FixedBoard() {}				// Virtual Destructor.
+
+        // Copies the individuals of a life cycle with the same size.
+        virtual void Load(const LifeCycle &lifecycle) = 0;
+        virtual void Step(int generations) = 0;
+
+        virtual bool IsAlive(int row, int column) const = 0;
+        virtual uint64_t Population() const = 0;
+
+        // Hash of the biotope for the cycle detection. Not the hash of the LifeCycle, but also changed by every
+        // individual.
+        virtual uint64_t Hash() const = 0;
+
+        virtual uint64_t Generation() const = 0;
+        virtual int Rows() const = 0;
+        virtual int Columns() const = 0;
+};
+
+/** @class FixedLifeCycle
+ *  @brief Biotope of BoardRows x BoardColumns individuals with the rule Rule.
+ */
+template<int BoardRows, int BoardColumns, class Rule>
+class FixedLifeCycle : public FixedBoard
+{
+        static_assert(BoardRows > 0 && BoardColumns > 0 && BoardColumns % tile_size == 0,
+                      "The columns have to fill whole words.");
+
+public:
+        static constexpr int words = BoardColumns / tile_size;
+
+        // Every row starts at a cache line of 64 bytes. Rows of a multiple of 4 kB get one cache line more, otherwise
+        // the three rows, which one step reads, would fall into the same cache sets.
+        static constexpr int row_words = (words + 7) & ~7;
+        static constexpr int stride = row_words % 512 == 0 ? row_words + 8 : row_words;
+
+        FixedLifeCycle(int threads)
+        {
+            for (uint64_t *&cells : _cells)
+            {
+                cells = (uint64_t *) AllocateBoard((size_t) BoardRows * stride * sizeof(uint64_t));
+                memset(cells, 0, (size_t) BoardRows * stride * sizeof(uint64_t));
+            }
+
+            _front = 0;
+            _generation = 0;
+            _row_population.assign(BoardRows, 0);
+            _row_hash.assign(BoardRows, 0);
+
+            if (threads > 1)
+            {
+                _pool.reset(new WorkerPool(threads));
+            }
+        }
+
+        virtual ~FixedLifeCycle()
+        {
+            FreeBoard(_cells[0], (size_t) BoardRows * stride * sizeof(uint64_t));
+            FreeBoard(_cells[1], (size_t) BoardRows * stride * sizeof(uint64_t));
+        }
+
+        void Load(const LifeCycle &lifecycle) override
+        {
+            // The columns fill whole tiles, so every word of a row is one row of a tile.
+            for (int row = 0; row < BoardRows; row++)
+            {
+                for (int w = 0; w < words; w++)
+                {
+                    _cells[_front][(size_t) row * stride + w] =
+                        lifecycle.TileRow(lifecycle.TileSlot(row / tile_size, w), row % tile_size);
+                }
+
+                this->SummarizeRow(row, &_cells[_front][(size_t) row * stride]);
+            }
+
+            _generation = lifecycle.Generation();
+        }
+
+        void Step(int generations) override
+        {
+            for (int i = 0; i < generations; i++)
+            {
+                if (_pool)
+                {
+                    _pool->ParallelFor(BoardRows, 16, [this](int begin, int end, int worker)
+                    {
+                        this->StepRows(begin, end);
+                    });
+                }
+                else
+                {
+                    this->StepRows(0, BoardRows);
+                }
+
+                _front ^= 1;
+                _generation++;
+            }
+        }
+
+        bool IsAlive(int row, int column) const override
+        {
+            return (_cells[_front][(size_t) row * stride + column / tile_size] >> (column % tile_size)) & 1;
+        }
+
+        // The rows are counted and hashed, when they are stepped, so both only add up the rows.
+        uint64_t Population() const override
+        {
+            uint64_t population = 0;
+
+            for (int row = 0; row < BoardRows; row++)
+            {
+                population += _row_population[row];
+            }
+
+            return population;
+        }
+
+        uint64_t Hash() const override
+        {
+            uint64_t hash = 0;
+
+            for (int row = 0; row < BoardRows; row++)
+            {
+                hash ^= _row_hash[row];
+            }
+
+            return hash;
+        }
+
+        uint64_t Generation() const override { return _generation; }
+        int Rows() const override { return BoardRows; }
+        int Columns() const override { return BoardColumns; }
+
+private:
+        /** @fn FixedLifeCycle::SummarizeRow(int row, const uint64_t *cells)
+         *  @brief Population and hash of one row of the front buffer, the row is still in the L1 cache.
+         *
+         *  The hash is the one of the tiles in lifeCycle.cpp: FNV-1a over the words, finished with splitmix64.
+         */
+        void SummarizeRow(int row, const uint64_t *cells)
+        {
+            uint64_t hash = 0xcbf29ce484222325ULL ^ ((uint64_t) row * 0x9e3779b97f4a7c15ULL);
+            uint64_t population = 0;
+
+            for (int w = 0; w < words; w++)
+            {
+                hash = (hash ^ cells[w]) * 0x100000001b3ULL;
+                hash ^= hash >> 32;
+                population += __builtin_popcountll(cells[w]);
+            }
+
+            hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+
+            _row_hash[row] = hash ^ (hash >> 31);
+            _row_population[row] = population;
+        }
+
+        /** @fn FixedLifeCycle::StepRows(int begin, int end)
+         *  @brief Calculates the next generation of the rows [begin, end).
+         */
+        void StepRows(int begin, int end)
+        {
+            static const uint64_t empty[words] = {};
+
+            const uint64_t *current = _cells[_front];
+            uint64_t *next = _cells[_front ^ 1];
+
+            for (int row = begin; row < end; row++)
+            {
+                const uint64_t *above = row > 0 ? &current[(size_t) (row - 1) * stride] : empty;
+                const uint64_t *middle = &current[(size_t) row * stride];
+                const uint64_t *below = row < BoardRows - 1 ? &current[(size_t) (row + 1) * stride] : empty;
+                uint64_t *result = &next[(size_t) row * stride];
+
+                for (int w = 0; w < words; w++)
+                {
+                    // The bits, which are shifted in, come from the neighbouring words of the same row.
+                    uint64_t west_above = w > 0 ? above[w - 1] >> 63 : 0;
+                    uint64_t west_middle = w > 0 ? middle[w - 1] >> 63 : 0;
+                    uint64_t west_below = w > 0 ? below[w - 1] >> 63 : 0;
+                    uint64_t east_above = w < words - 1 ? above[w + 1] << 63 : 0;
+                    uint64_t east_middle = w < words - 1 ? middle[w + 1] << 63 : 0;
+                    uint64_t east_below = w < words - 1 ? below[w + 1] << 63 : 0;
+
+                    uint64_t neighbours[8] =
+                    {
+                        (above[w] << 1) | west_above, above[w], (above[w] >> 1) | east_above,
+                        (middle[w] << 1) | west_middle, (middle[w] >> 1) | east_middle,
+                        (below[w] << 1) | west_below, below[w], (below[w] >> 1) | east_below
+                    };
+
+                    uint64_t ones = 0, twos = 0, fours = 0, eights = 0;
+
+                    for (int n = 0; n < 8; n++)
+                    {
+                        uint64_t carry_one = ones & neighbours[n];
+                        ones ^= neighbours[n];
+
+                        uint64_t carry_two = twos & carry_one;
+                        twos ^= carry_one;
+
+                        uint64_t carry_four = fours & carry_two;
+                        fours ^= carry_two;
+
+                        eights |= carry_four;
+                    }
+
+                    result[w] = ApplyRule<Rule>(middle[w], ones, twos, fours, eights);
+                }
+
+                this->SummarizeRow(row, result);
+            }
+        }
+
+        uint64_t *_cells[2];
+        int _front;
+        uint64_t _generation;
+
+        // Population and hash of every row of the front buffer.
+        std::vector<uint64_t> _row_population, _row_hash;
+
+        std::unique_ptr<WorkerPool> _pool;
+};
+
+    // Built once in fixedLifeCycle.cpp.
+    extern template class FixedLifeCycle<256, 256, ConwayRule>;
+    extern template class FixedLifeCycle<512, 512, ConwayRule>;
+    extern template class FixedLifeCycle<1024, 1024, ConwayRule>;
+    extern template class FixedLifeCycle<2048, 2048, ConwayRule>;
+    extern template class FixedLifeCycle<4096, 4096, ConwayRule>;
+    extern template class FixedLifeCycle<16384, 16384, ConwayRule>;
+    extern template class FixedLifeCycle<1024, 1024, HighLifeRule>;
+    extern template class FixedLifeCycle<4096, 4096, HighLifeRule>;
+
+    // Instantiation for the size and rule (e.g. "B3/S23"), nothing if there is none.
+    std::unique_ptr<FixedBoard> CreateFixedLifeCycle(int rows, int columns, std::string rule, int threads);
+}
+
+#endif // HEADER_FIXEDLIFECYCLE_HPP_AP_19102026
@@ -0,0 +1,95 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    framePipeline.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Steps the biotope on its own thread, while the window shows the generations before.
+ *
+ * Without the pipeline every frame steps the biotope, updates the render buffer and draws it, one after another, so a
+ * frame takes the sum of all three. With the pipeline the life cycle belongs to a stepping thread. It steps
+ * generation N + 1, with statistics, census, history and export, while the window thread brings its view to
+ * generation N, prepares the pixels and draws them. A frame takes only as long as the slower of both sides then.
+ *
+ * The stepping thread packs the tiles, which changed in a generation, into a frame. Full frames go through a bounded
+ * lock-free queue to the window thread, which copies them into a second life cycle, the view, and hands the frames
+ * back through a second queue. With all frames in flight the stepping thread waits: the pipeline is never more than
+ * "depth" generations ahead of the window. Edits of the window thread go the other way, they are applied between
+ * two generations.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_FRAMEPIPELINE_HPP_AP_19102026
+#define HEADER_FRAMEPIPELINE_HPP_AP_19102026
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "boardAllocator.hpp"
+#include "lifeCycle.hpp"
+#include "spscQueue.hpp"
+
+
+namespace GameOfLife
+{
+    // One generation on its way to the window: the tiles, which changed since the frame before.
+    struct struct_frame
+    {
+        uint64_t generation;
+        std::vector<int> slots;
+        board_vector<uint64_t> rows;        // tile_size rows per slot.
+        board_vector<uint8_t> ages;         // tile_size x tile_size ages per slot, if the life cycle keeps them.
+    };
+
+/** @class FramePipeline
+ *  @brief Stepping thread of the life cycle and the queues to and from the window thread.
+ */
+class FramePipeline
+{
+public:
+        // The view gets the current biotope right away. From now on, only the stepping thread uses the life cycle.
+        FramePipeline(LifeCycle &lifecycle, LifeCycle &view, int depth);
+        virtual ~FramePipeline();				// Virtual Destructor.
+
+        // Window thread: the next generation into the view. False, if the stepping thread is not that far yet.
+        bool NextFrame();
+
+        // Window thread: a batch of edits for the life cycle.
+        void SubmitEdits(std::vector<struct_cell_change> &&changes);
+
+        // Like "Frame pipeline: 1200 generations, ...", which side waited for the other.
+        void Report() const;
+
+private:
+        void Run();
+        void Capture(struct_frame &frame);
+
+        LifeCycle &_lifecycle;
+        LifeCycle &_view;
+
+        std::vector<struct_frame> _frames;
+        SpscQueue<int> _free_frames, _ready_frames;
+        SpscQueue<std::vector<struct_cell_change>> _edits;
+
+        // Stepping thread.
+        uint64_t _capture_stamp;
+        std::vector<struct_cell_change> _batch;
+        std::vector<uint64_t> _buffer;
+
+        // Window thread. Edits, which did not fit into the queue.
+        std::vector<struct_cell_change> _pending_edits;
+        uint64_t _frames_shown, _frames_missed;
+
+        std::atomic<uint64_t> _generations_stepped, _step_wait_microseconds;
+        std::atomic<bool> _stop;
+        std::thread _thread;
+};
+}
+
+#endif // HEADER_FRAMEPIPELINE_HPP_AP_19102026
@@ -0,0 +1,138 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    historyLog.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Compressed log of all generations and its replay.
+ *
+ * The log file starts with a struct_history_header and is followed by one record per generation. A record is a
+ * struct_history_record and its tiles: int32 tile_row, tile_column, uint32 code_length and the code of the XOR of the
+ * tile rows with the state of the previous record (see deltaCodec.hpp). Every key_frame_interval generations a key
+ * frame is written instead, which is the XOR with an empty biotope and contains only tiles with life.
+ *
+ * The seek index is a second file "<log>.index" with one struct_history_index per record. Both files are only
+ * appended, so a log of a crashed run stays readable up to its last complete record.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_HISTORYLOG_HPP_AP_19102026
+#define HEADER_HISTORYLOG_HPP_AP_19102026
+
+#include <stdio.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace GameOfLife
+{
+    class LifeCycle;
+
+    static constexpr char history_magic[8] = "GOLHIS1";
+
+    struct struct_history_header
+    {
+        char magic[8];
+        int32_t rows, columns;
+        uint32_t key_frame_interval;
+        uint32_t reserved;
+    };
+
+    struct struct_history_record
+    {
+        uint64_t generation, population;
+        uint32_t tiles;             // Number of tiles in the record.
+        uint32_t key_frame;         // 1, if the tiles are XORed with an empty biotope.
+        uint64_t bytes;             // Bytes of the tiles behind this header.
+    };
+
+    struct struct_history_index
+    {
+        uint64_t generation;
+        uint64_t offset;            // Position of the struct_history_record in the log file.
+        uint32_t key_frame;
+        uint32_t reserved;
+    };
+
+/** @class HistoryRecorder
+ *  @brief Writes the generations of a life cycle into the log.
+ *
+ *  Only the tiles, which changed since the last record, are compared with the recorded state, so a quiet biotope
+ *  costs a few bytes per generation.
+ */
+class HistoryRecorder
+{
+public:
+        HistoryRecorder(std::string path, const LifeCycle &lifecycle, int key_frame_interval);
+        virtual ~HistoryRecorder();				// Virtual Destructor.
+
+        bool IsOpen() const { return _file != nullptr; }
+        void Record(const LifeCycle &lifecycle);
+
+private:
+        void AppendTile(const LifeCycle &lifecycle, int slot, const uint64_t *rows);
+
+        std::string _path;
+        FILE *_file, *_index;
+        uint64_t _offset;
+        uint32_t _key_frame_interval;
+
+        bool _recorded;
+        uint64_t _generation, _key_frame_generation, _stamp;
+        uint64_t _records;
+
+        // Recorded state of the biotope.
+        std::vector<uint64_t> _shadow;
+        std::vector<int> _slots;
+        std::vector<uint8_t> _record;
+};
+
+/** @class HistoryReplay
+ *  @brief Reconstructs any recorded generation.
+ *
+ *  A jump decodes the nearest key frame before the target and the deltas up to the target. Steps forward only
+ *  decode the deltas behind the current position.
+ */
+class HistoryReplay
+{
+public:
+        HistoryReplay(std::string path);
+        virtual ~HistoryReplay();				// Virtual Destructor.
+
+        bool IsOpen() const { return _file >= 0 && !_records.empty(); }
+
+        int Rows() const { return _header.rows; }
+        int Columns() const { return _header.columns; }
+        uint32_t KeyFrameInterval() const { return _header.key_frame_interval; }
+
+        size_t Records() const { return _records.size(); }
+        size_t Position() const { return _position; }
+        uint64_t RecordGeneration(size_t record) const { return _records[record].generation; }
+
+        bool SeekRecord(size_t record, LifeCycle &lifecycle);
+        bool Seek(uint64_t generation, LifeCycle &lifecycle);
+
+private:
+        void ScanRecords(uint64_t file_size);
+        bool ApplyRecord(size_t record);
+
+        int _file;
+        struct_history_header _header;
+        std::vector<struct_history_index> _records;
+
+        // Decoded biotope: tile (tile_row, tile_column) is at (tile_row * tiles_x + tile_column) * tile_size.
+        int _tiles_x, _tiles_y;
+        std::vector<uint64_t> _board;
+        size_t _position;
+        bool _valid;
+
+        std::vector<uint8_t> _record;
+};
+}
+
+#endif // HEADER_HISTORYLOG_HPP_AP_19102026
@@ -10,57 +10,424 @@
  *
  * @brief   Class to manage the biotope.
  *
- * This class encapsulates a structure of elements or rather life forms. The individuals live and die according to the 
+ * This class encapsulates a structure of elements or rather life forms. The individuals live and die according to the
  * set rules.
+ *
+ * The biotope is stored in tiles of 64 x 64 individuals, one bit per individual and one 64 bit word per tile row. The
+ * tiles are placed in memory along a Morton (Z-order) curve, so that tiles which are close on the board are also close
+ * in memory. Before a tile is stepped, the border cells of its eight neighbours are copied into a small halo, thus
+ * stepping one tile touches only about one kilobyte of data.
+ *
+ * Tiles, which only repeated themselves with a period of 1 or 2 for a while (the still lifes and blinkers of a settled
+ * biotope), can be stored cold: their two phases are compressed with the run length code of deltaCodec.hpp and the
+ * memory pages of their buffers are given back to the system. Cold tiles are not stepped, they take the phase of the
+ * generation. A cold tile is decompressed, as soon as a neighbour does something else. Readers get the rows of any
+ * tile by TileRows(slot, buffer) or TileRow(slot, row).
+ *
+ * Optionally every individual has an age: the generations it is alive, saturated at 255. The ages are a plane of one
+ * byte per individual next to the tiles and are updated, while a tile is stepped. A tile, which is not stepped, did
+ * not change, so all its living individuals became older by the generations since its last step. This difference is
+ * only added, when the ages are read.
  */
 // --------------------------------------------------------------------------------------------------------------------
 
 #ifndef HEADER_LIFECYCLE_HPP_AP_28052020
 #define HEADER_LIFECYCLE_HPP_AP_28052020
 
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #include <string>
 
+#include "boardAllocator.hpp"
+#include "cycleDetector.hpp"
+#include "lifeRule.hpp"
 
-namespace GameOfLife 
+
+namespace GameOfLife
 {
-    struct struct_individuals
-    {
-        bool change, alive;
-        int living_neighbours;
-    };
+    // Edge length of one tile in individuals. One tile row is exactly one 64 bit word.
+    static constexpr int tile_size = 64;
+
+    // Words between the tiles in memory: the front and back buffer and one cache line. Without the padding, the tiles
+    // would lie 1 kB apart, and the buffers, which one step reads, would compete for the same cache sets.
+    static constexpr int tile_stride = 2 * tile_size + cache_line_size / sizeof(uint64_t);
 
     enum order_mode
     {
-        random, 
+        random,
         test_pattern,
         empty
     };
 
+    enum step_mode
+    {
+        full_sweep,                 // Step every tile in every generation.
+        active_tiles,               // Step only tiles which changed or have a changed neighbour.
+        events                      // Evaluate only individuals, whose neighbour count changed (see StepEvents()).
+    };
+
+    enum step_kernel
+    {
+        bitwise,                    // 64 individuals per word with bit-parallel adders.
+        lookup_table                // Blocks of 2 x 2 individuals from a precomputed table.
+    };
+
+    enum cycle_action
+    {
+        keep_running,               // Only report the cycle.
+        halt,                       // Stop the life cycle.
+        fast_forward                // Jump as close as possible to the maximum number of generations.
+    };
+
+    // Order of the neighbours in struct_tile::neighbours:
+    //
+    //   0   1   2
+    //   3   X   4
+    //   5   6   7
+    //
+    struct struct_tile
+    {
+        int tile_row, tile_column;
+        int neighbours[8];          // Slots of the neighbour tiles, -1 outside of the board.
+        int valid_rows;             // Number of rows inside of the board.
+        uint64_t column_mask;       // Bit mask of the columns inside of the board.
+    };
+
+    // The border cells of the eight neighbour tiles. Bit r of west/east belongs to row r of the tile, bit c of
+    // north/south belongs to column c. The corners are stored in the bits 0 (north west), 1 (north east),
+    // 2 (south west) and 3 (south east).
+    struct struct_halo
+    {
+        uint64_t north, south, west, east, corners;
+    };
+
+    // Edit of one individual for LifeCycle::SetCells().
+    struct struct_cell_change
+    {
+        int row, column;
+        bool alive;
+    };
+
+    // Individuals around the board, e.g. the border cells of the neighbouring blocks in the distributed mode. Bit c
+    // of word w of north/south is column 64 w + c of the row above/below the board, bit r of word w of west/east is
+    // row 64 w + r of the column left/right of the board. The corners use the bit order of struct_halo. South and
+    // east are only used, if the board ends at a tile border.
+    struct struct_outer_halo
+    {
+        board_vector<uint64_t> north, south, west, east;
+        uint64_t corners;
+    };
+
+    class WorkerPool;
+    class SharedStateExporter;
+    class HistoryRecorder;
+    class EngineSelector;
+    class ObjectCensus;
+    class EdgeMonitor;
+
 /** @class LifeCycle
  *  @brief Class to manage the biotope.
  *
- *  This class encapsulates a structure of elements or rather life forms. The individuals live and die according to the 
+ *  This class encapsulates a structure of elements or rather life forms. The individuals live and die according to the
  * set rules.
  */
 class LifeCycle
 {
 public:
-	LifeCycle(int rows, int columns, int number_of_elements, std::string mode, std::string pattern, int live_rate);
+	LifeCycle(int rows, int columns, int number_of_elements, std::string mode, std::string pattern, int live_rate,
+                  bool verbose = true);
 	virtual ~LifeCycle();				// Virtual Destructor.
-	
+
 	void LifeRules();
+
+        // The phases of LifeRules(), so the distributed mode can exchange the halo while the interior is stepped.
+        bool BeginGeneration();
+        void StepInteriorTiles();
+        void StepBoundaryTiles();
+        void CommitGeneration();
+
         void RandomPatternGenerator();
         void SinglePatternGenerator();
         void EmptyPatternGenerator();
-	
-	std::vector<struct_individuals> individuals;
+
+        // Pinning policy of the threads: none, compact or scatter (see numaTopology.hpp).
+        void SetThreads(int threads, std::string pinning = "none");
+        void SetStepMode(std::string mode);
+        void SetStats(int interval, std::string stats_file);
+        void SetKernel(std::string kernel);
+        void SetSeed(unsigned seed) { this->seed = seed; }
+
+        // Rule in the notation B3/S23. Rules other than Conway's are stepped with the bitwise kernel.
+        void SetRule(std::string rule);
+        void SetRule(const struct_rule &rule) { this->_rule = rule; }
+        const struct_rule &Rule() const { return _rule; }
+
+        // New random soup in generation 0. Reuses all buffers, so a batch can run many biotopes in one life cycle.
+        void Restart(unsigned seed, int live_rate);
+
+        // The given individuals on an empty board in generation 0.
+        void Restart(const std::vector<struct_cell_change> &individuals);
+        void SetCycleDetection(std::string action, int window);
+        void SetMaxGenerations(uint64_t max_generations) { this->_max_generations = max_generations; }
+        void EnableSharedExport(std::string name, int slots);
+        void EnableHistory(std::string path, int key_frame_interval);
+
+        // Census of the objects every interval generations (0: never) and once, when the biotope starts to repeat
+        // itself. With a file name, every census is appended to this CSV file.
+        void EnableCensus(int interval, std::string census_file);
+        const ObjectCensus &TakeCensus();
+
+        // Removes gliders and other spaceships, which fly out of the biotope within the margin of the border, before
+        // they turn into debris there.
+        void EnableEdgeMonitor(int margin);
+
+        // Compresses the tiles, which only repeated themselves with a period of 1 or 2 for the given number of
+        // generations, like their neighbours (0: never). Only in the step mode active_tiles.
+        void EnableColdTiles(int generations);
+        int ColdTiles() const { return _cold_tile_count; }
+        size_t ColdBytes() const { return _cold_bytes; }
+
+        // Takes the individuals around the board from the outer halo instead of treating them as dead. The border
+        // tiles are stepped in every generation then.
+        void EnableOuterHalo();
+        struct_outer_halo &OuterHalo() { return _outer_halo; }
+
+        // Replaces the biotope. Tile (tile_row, tile_column) is at (tile_row * tiles_x + tile_column) * tile_size.
+        void LoadTiles(const std::vector<uint64_t> &rows, uint64_t generation);
+
+        // Brings some tiles to a later generation of the same biotope, e.g. of a life cycle on another thread. The
+        // rows hold tile_size words per slot. The tiles count as changed in this generation.
+        void CopyTiles(const std::vector<int> &slots, const uint64_t *rows, uint64_t generation,
+                       const uint8_t *ages = nullptr);
+
+        // Keeps the age of every individual (see above). The ages of the copied tiles hold tile_size x tile_size
+        // bytes per slot, row by row.
+        void EnableCellAges(bool enable);
+        bool CellAgesEnabled() const { return !_ages.empty(); }
+        uint8_t CellAge(int row, int column) const;
+        void TileAges(int slot, uint8_t *ages) const;
+
+        // True, if all living individuals of the tile reached the highest age.
+        bool TileAgesSaturated(int slot) const { return _generation - _age_generation[slot] >= max_cell_age; }
+
+        static constexpr int max_cell_age = 255;
+
+        bool IsAlive(int row, int column) const;
+        void SetCell(int row, int column, bool alive);
+
+        // Applies a batch of edits between two generations. Population and hash are updated once per touched tile,
+        // only the touched tiles become active and are marked as changed for the renderer.
+        void SetCells(const std::vector<struct_cell_change> &changes);
+
+        // Rows of the tile in the given slot. Bit c of row r is the individual in column c. A cold tile is decoded into
+        // the buffer of tile_size words, the rows of the other tiles are returned directly.
+        inline const uint64_t *TileRows(int slot, uint64_t *buffer) const
+        {
+            return _cold_of_slot[slot] < 0 ? this->HotRows(slot) : this->ColdTileRows(slot, buffer);
+        }
+
+        // One row of the tile in the given slot, for readers of a few rows.
+        inline uint64_t TileRow(int slot, int row) const
+        {
+            return _cold_of_slot[slot] < 0 ? this->HotRows(slot)[row] : this->ColdTileRow(slot, row);
+        }
+
+        inline int TileSlot(int tile_row, int tile_column) const
+        {
+            return _slot_of_tile[tile_row * tiles_x + tile_column];
+        }
+
+        int Rows() const { return _rows; }
+        int Columns() const { return _columns; }
+        uint64_t Population() const { return _population; }
+        uint64_t Generation() const { return _generation; }
+        uint64_t Hash() const { return _board_hash; }
+
+        // True, if the life cycle does not step any more (cycle with the action halt or maximum generations).
+        bool Halted() const { return _halted; }
+
+        // Counter, which increases with every generation and every edit. Each tile keeps the value of its last change.
+        uint64_t ChangeStamp() const { return _change_stamp; }
+        uint64_t TileStamp(int slot) const { return _tile_stamp[slot]; }
+        void ChangedTilesSince(uint64_t stamp, std::vector<int> &slots) const;
+
+        // Period and onset, as soon as the biotope repeats itself.
+        const struct_cycle &Cycle() const { return _cycle_detector.cycle; }
+
+        // Tile grid and the slots of the tiles, which changed in the last generation, by the pattern generators or by
+        // edits since then.
+        std::vector<struct_tile> tiles;
+        std::vector<int> changed_tiles;
+        int tiles_x, tiles_y;
+
 	order_mode mode_enum;
+        step_mode step_mode_enum;
+        step_kernel kernel_enum;
+        cycle_action cycle_action_enum;
 private:
         void Init(GameOfLife::order_mode mode);
-        
+        void TileConfigurator();
+        void PlaceTiles();
+        void ExchangeHalo(int slot, struct_halo &halo) const;
+        void StepTile(int slot);
+        void StepTiles(const std::vector<int> &slots);
+        uint64_t OuterCell(int row, int column) const;
+        void MarkAllChanged();
+        void TouchTile(int slot);
+        void FinishEdits();
+        int FlagActiveTiles();
+        void UpdateActiveTiles();
+        void SampleEngine();
+        void SwitchStepMode(step_mode mode);
+        EngineSelector &Selector();
+        void CheckCycle();
+
+        void FreezeQuietTiles();
+        void FreezeTile(int slot);
+        void ThawTile(int slot);
+        void ThawActiveTiles();
+        void AdvanceColdTiles();
+        void ReleaseColdTile(int cold);
+        void DropColdTiles();
+        void UpdateAges(int slot, const uint64_t *current, const uint64_t *next);
+        void SettleAges(int slot);
+
+        bool EventDriven() const { return step_mode_enum == step_mode::events && !_outer_halo_enabled; }
+        void StepEvents();
+        void SizeEvents();
+        void RebuildEvents();
+        void RecountEventTile(int slot);
+        inline void QueueEvent(uint64_t cell)
+        {
+            if (!(_event_queued[cell / 64] & (1ULL << (cell % 64))))
+            {
+                _event_queued[cell / 64] |= 1ULL << (cell % 64);
+                _event_next.push_back(cell);
+            }
+        }
+        void ReleasePages(const std::vector<int> &slots);
+        void DecodeColdTile(int cold, int parity, uint64_t *rows) const;
+        const uint64_t *ColdTileRows(int slot, uint64_t *buffer) const;
+        uint64_t ColdTileRow(int slot, int row) const;
+        uint64_t ColdTileFlips(int slot, int row) const;
+
+        // Only for tiles, which are not cold.
+        inline const uint64_t *HotRows(int slot) const
+        {
+            return &_cells[(size_t) slot * tile_stride + _front[slot] * tile_size];
+        }
+
+        inline uint64_t *FrontRows(int slot)
+        {
+            return &_cells[(size_t) slot * tile_stride + _front[slot] * tile_size];
+        }
+
+        inline uint64_t *BackRows(int slot)
+        {
+            return &_cells[(size_t) slot * tile_stride + (_front[slot] ^ 1) * tile_size];
+        }
+
         int _elements, _rows, _columns, _live_rate;
+        struct_rule _rule;
         unsigned seed;
+        bool _verbose;
+
+        // Two buffers per tile: the current generation (front) and the next generation (back).
+        board_vector<uint64_t> _cells;
+        std::vector<uint8_t> _front;
+        std::vector<int> _slot_of_tile;
+
+        // Tiles to step in the next generation, and the same split up for the distributed mode.
+        std::vector<int> _active_slots;
+        std::vector<uint8_t> _active;
+        std::vector<int> _interior_slots, _boundary_slots;
+        std::vector<uint8_t> _on_boundary;
+
+        struct_outer_halo _outer_halo;
+        bool _outer_halo_enabled;
+
+        // Results of the last step of each tile.
+        std::vector<uint8_t> _tile_changed;
+        std::vector<int> _tile_population;
+
+        // Tiles of the running batch of SetCells().
+        std::vector<uint8_t> _touched;
+        std::vector<int> _touched_slots;
+        std::vector<uint64_t> _tile_hash, _tile_new_hash;
+        std::vector<uint64_t> _tile_stamp;
+
+        // Stamp of the last change and of the last generation (or pattern).
+        uint64_t _change_stamp, _commit_stamp;
+
+        uint64_t _population, _generation, _max_generations;
+        uint64_t _board_hash;
+        bool _halted;
+
+        CycleDetector _cycle_detector;
+
+        std::unique_ptr<WorkerPool> _pool;
+        std::unique_ptr<SharedStateExporter> _exporter;
+        std::unique_ptr<HistoryRecorder> _history;
+
+        std::unique_ptr<ObjectCensus> _census;
+        int _census_interval;
+        bool _census_cycle;
+
+        std::unique_ptr<EdgeMonitor> _edge_monitor;
+
+        // Code of one or more cold tiles with the same content: the phase of the even generations, followed by the
+        // XOR with the phase of the odd generations (zero for still lifes).
+        struct struct_cold_tile
+        {
+            std::vector<uint8_t> code;
+            uint32_t split, references;
+            bool oscillating;
+        };
+
+        // Cold tile of each slot (-1: the tile is in _cells). Small codes, like the one of an empty tile, are shared.
+        std::vector<int> _cold_of_slot;
+        std::vector<struct_cold_tile> _cold_tiles;
+        std::vector<int> _free_cold_tiles;
+        std::unordered_map<uint64_t, int> _shared_cold_tiles;
+        std::vector<int> _cold_oscillating;
+        bool _cold_list_dirty;
+        std::vector<uint8_t> _cold_code;
+        std::vector<int> _frozen_slots;
+        int _cold_generations, _cold_sweep_countdown, _cold_tile_count;
+        uint64_t _cold_sweep_stamp;
+        size_t _cold_bytes;
+
+        // Hash and population of the cold tiles in the even and odd generations.
+        uint64_t _cold_hash[2], _cold_population[2];
+
+        // Whether the last step of a tile did not repeat the generation before the last one, the change stamp of the
+        // last such step and the generation after the last step (the back buffer is the previous generation, if it
+        // is the current one). Stopped oscillators, which did not change, are waking.
+        std::vector<uint8_t> _tile_aperiodic;
+        std::vector<uint64_t> _tile_aperiodic_stamp, _tile_stepped;
+        std::vector<int> _waking_slots;
+
+        // Age of every individual, tile by tile, and the generation of the stored ages of each tile. Dead
+        // individuals can keep an old age, the readers only look at the living ones.
+        board_vector<uint8_t> _ages;
+        std::vector<uint64_t> _age_generation;
+
+        // Step mode events: the living neighbours of every individual (row by row over the board), the individuals,
+        // which are evaluated in the next generation, once each by the bitmap, and the births and deaths of one
+        // generation. Edited tiles are counted again before the next generation, a new biotope completely.
+        std::vector<uint8_t> _neighbour_counts;
+        std::vector<uint64_t> _event_queued;
+        std::vector<uint64_t> _event_cells, _event_next, _event_flips;
+        std::vector<int> _event_dirty_slots;
+        bool _events_valid;
+
+        // Measurements for the choice of the step mode, summed up since the last sample.
+        std::unique_ptr<EngineSelector> _selector;
+        uint64_t _sample_generations, _sample_stepped, _sample_changed;
+        std::chrono::steady_clock::time_point _sample_start;
 };
 
 }
@@ -0,0 +1,131 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    lifeRule.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Rules of life as compile-time constants.
+ *
+ * A rule is the set of neighbour counts, which give birth to a dead individual, and the set of neighbour counts,
+ * which let a living individual survive. Bit n of "birth" and "survive" stands for n living neighbours. The usual
+ * notation is B3/S23 for the rule of Conway.
+ *
+ * The rules of the compile-time kernels are types. A rule chosen at runtime, e.g. from the sim.config, is a
+ * struct_rule with the same two bit sets and is applied with the same bit-sliced neighbour counts.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_LIFERULE_HPP_AP_19102026
+#define HEADER_LIFERULE_HPP_AP_19102026
+
+#include <cstdint>
+#include <string>
+#include <utility>
+
+
+namespace GameOfLife
+{
+    template<uint16_t Birth, uint16_t Survive>
+    struct LifeRule
+    {
+        static constexpr uint16_t birth = Birth;
+        static constexpr uint16_t survive = Survive;
+    };
+
+    using ConwayRule = LifeRule<1 << 3, 1 << 2 | 1 << 3>;                   // B3/S23
+    using HighLifeRule = LifeRule<1 << 3 | 1 << 6, 1 << 2 | 1 << 3>;        // B36/S23
+
+    /** @fn RuleTerm(uint64_t alive, uint64_t ones, uint64_t twos, uint64_t fours, uint64_t eights)
+     *  @brief Individuals of the next generation with exactly N living neighbours.
+     *
+     *  The neighbour count is given bit-sliced. Only the counts 0 and 8 differ in the bit "eights" alone, so it is
+     *  only looked at for them and falls away for all other rules.
+     */
+    template<class Rule, int N>
+    inline uint64_t RuleTerm(uint64_t alive, uint64_t ones, uint64_t twos, uint64_t fours, uint64_t eights)
+    {
+        constexpr bool birth = (Rule::birth >> N) & 1, survive = (Rule::survive >> N) & 1;
+
+        if constexpr (!birth && !survive)
+        {
+            return 0;
+        }
+        else
+        {
+            uint64_t count = ((N & 1) ? ones : ~ones) & ((N & 2) ? twos : ~twos) & ((N & 4) ? fours : ~fours);
+
+            if constexpr (N == 0 || N == 8)
+            {
+                count &= N == 8 ? eights : ~eights;
+            }
+
+            return birth && survive ? count : birth ? count & ~alive : count & alive;
+        }
+    }
+
+    template<class Rule, int... N>
+    inline uint64_t ApplyRule(uint64_t alive, uint64_t ones, uint64_t twos, uint64_t fours, uint64_t eights,
+                              std::integer_sequence<int, N...>)
+    {
+        return (RuleTerm<Rule, N>(alive, ones, twos, fours, eights) | ...);
+    }
+
+    /** @fn ApplyRule(uint64_t alive, uint64_t ones, uint64_t twos, uint64_t fours, uint64_t eights)
+     *  @brief Next state of 64 individuals from their state and their bit-sliced neighbour counts.
+     */
+    template<class Rule>
+    inline uint64_t ApplyRule(uint64_t alive, uint64_t ones, uint64_t twos, uint64_t fours, uint64_t eights)
+    {
+        return ApplyRule<Rule>(alive, ones, twos, fours, eights, std::make_integer_sequence<int, 9>());
+    }
+
+    // Rule chosen at runtime. Bit n of birth and survive as in LifeRule.
+    struct struct_rule
+    {
+        uint16_t birth, survive;
+
+        bool operator==(const struct_rule &other) const
+        {
+            return birth == other.birth && survive == other.survive;
+        }
+
+        bool operator!=(const struct_rule &other) const { return !(*this == other); }
+    };
+
+    static constexpr struct_rule conway_rule = {ConwayRule::birth, ConwayRule::survive};
+
+    // Reads "B3/S23", also "b3s23". False for anything else and for births without neighbours (B0), which would
+    // need the dead background of the whole board to change.
+    bool ParseRule(std::string text, struct_rule &rule);
+    std::string RuleName(const struct_rule &rule);
+
+    /** @fn ApplyRule(const struct_rule &rule, uint64_t alive, uint64_t ones, uint64_t twos, uint64_t fours,
+     *                uint64_t eights)
+     *  @brief Next state of 64 individuals with a rule chosen at runtime.
+     */
+    inline uint64_t ApplyRule(const struct_rule &rule, uint64_t alive, uint64_t ones, uint64_t twos, uint64_t fours,
+                              uint64_t eights)
+    {
+        uint64_t next = 0;
+
+        // Up to 9 for counts, which include the individual itself (see multiverse.cpp).
+        for (int n = 0; n <= 9; n++)
+        {
+            if (((rule.birth | rule.survive) >> n) & 1)
+            {
+                uint64_t count = ((n & 1) ? ones : ~ones) & ((n & 2) ? twos : ~twos) & ((n & 4) ? fours : ~fours) &
+                                 ((n & 8) ? eights : ~eights);
+
+                next |= count & (((rule.birth >> n) & 1 ? ~alive : 0) | ((rule.survive >> n) & 1 ? alive : 0));
+            }
+        }
+
+        return next;
+    }
+}
+
+#endif // HEADER_LIFERULE_HPP_AP_19102026
@@ -0,0 +1,132 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    lookupKernel.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Lookup table kernel, which steps blocks of 2 x 2 individuals at once.
+ *
+ * The next generation of a 2 x 2 block depends only on the surrounding 4 x 4 individuals. These 16 bits are used as
+ * index into a table with the four new states. The table is generated by the compiler, so the kernel needs neither
+ * the neighbour counting nor any special instruction set.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_LOOKUPKERNEL_HPP_AP_19102026
+#define HEADER_LOOKUPKERNEL_HPP_AP_19102026
+
+#include <cstdint>
+
+#include "lifeCycle.hpp"
+
+
+namespace GameOfLife
+{
+    // Index layout: bit (4 * r + c) is the individual in row r and column c of the 4 x 4 neighbourhood.
+    // Result layout: bit 0 (1, 1), bit 1 (1, 2), bit 2 (2, 1), bit 3 (2, 2).
+    struct struct_block_table
+    {
+        uint8_t next[1 << 16];
+    };
+
+    constexpr uint32_t Bit(uint32_t index, int row, int column)
+    {
+        return (index >> (4 * row + column)) & 1;
+    }
+
+    // Written out without loops, otherwise the compiler runs into its limit for constant expressions.
+    constexpr uint8_t NextState(uint32_t index, int row, int column)
+    {
+        uint32_t living_neighbours = Bit(index, row - 1, column - 1) + Bit(index, row - 1, column) +
+                                     Bit(index, row - 1, column + 1) + Bit(index, row, column - 1) +
+                                     Bit(index, row, column + 1) + Bit(index, row + 1, column - 1) +
+                                     Bit(index, row + 1, column) + Bit(index, row + 1, column + 1);
+
+        return living_neighbours == 3 || (Bit(index, row, column) && living_neighbours == 2);
+    }
+
+    constexpr struct_block_table MakeBlockTable()
+    {
+        struct_block_table table = {};
+
+        for (uint32_t index = 0; index < (1u << 16); index++)
+        {
+            table.next[index] = NextState(index, 1, 1) | NextState(index, 1, 2) << 1 |
+                                NextState(index, 2, 1) << 2 | NextState(index, 2, 2) << 3;
+        }
+
+        return table;
+    }
+
+    inline constexpr struct_block_table block_table = MakeBlockTable();
+
+/** @fn StepRowsLookup(const uint64_t *current, const struct_halo &halo, uint64_t *next)
+ *  @brief Applies the rules to one tile with the 2 x 2 block table.
+ *
+ *  Each row gets its west and east halo bit attached, which gives 66 bit wide rows. Four of them are the source for
+ *  one row of 32 blocks.
+ */
+inline void StepRowsLookup(const uint64_t *current, const struct_halo &halo, uint64_t *next)
+{
+    auto padded_row = [&](int r) -> unsigned __int128
+    {
+        uint64_t row, west, east;
+
+        if (r < 0)
+        {
+            row = halo.north;
+            west = halo.corners & 1;
+            east = (halo.corners >> 1) & 1;
+        }
+        else if (r >= tile_size)
+        {
+            row = halo.south;
+            west = (halo.corners >> 2) & 1;
+            east = (halo.corners >> 3) & 1;
+        }
+        else
+        {
+            row = current[r];
+            west = (halo.west >> r) & 1;
+            east = (halo.east >> r) & 1;
+        }
+
+        return ((unsigned __int128) east << (tile_size + 1)) | ((unsigned __int128) row << 1) | west;
+    };
+
+    unsigned __int128 rows[4] = {padded_row(-1), padded_row(0), padded_row(1), padded_row(2)};
+
+    for (int r = 0; r < tile_size; r += 2)
+    {
+        uint64_t upper = 0, lower = 0;
+
+        for (int c = 0; c < tile_size; c += 2)
+        {
+            uint32_t index = (uint32_t) ((rows[0] >> c) & 0xF)       | (uint32_t) ((rows[1] >> c) & 0xF) << 4 |
+                             (uint32_t) ((rows[2] >> c) & 0xF) << 8  | (uint32_t) ((rows[3] >> c) & 0xF) << 12;
+
+            uint64_t block = block_table.next[index];
+
+            upper |= (block & 3) << c;
+            lower |= ((block >> 2) & 3) << c;
+        }
+
+        next[r] = upper;
+        next[r + 1] = lower;
+
+        // Move the window two rows down.
+        rows[0] = rows[2];
+        rows[1] = rows[3];
+        rows[2] = padded_row(r + 3);
+        rows[3] = padded_row(r + 4);
+    }
+}
+
+}
+
+
+#endif // HEADER_LOOKUPKERNEL_HPP_AP_19102026
@@ -0,0 +1,99 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    multiverse.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Up to 256 independent biotopes of the same size, stepped together bit-sliced.
+ *
+ * Monte-Carlo studies step many small biotopes. Here every individual position holds one bit per biotope, the
+ * universes: bit k of word l belongs to universe 64 l + k. One pass of the bitwise full adders over the board steps
+ * all universes at once, as many as the words of a position have bits. The lanes of 1, 2 or 4 words per position
+ * are compile-time loops without intrinsics, so the compiler puts them into vector registers (see the option
+ * GAME_ENABLE_NATIVE for AVX2).
+ *
+ * The board has a frame of dead individuals, so the pass needs no special cases at the border. The population of a
+ * universe is the popcount of its bits: blocks of 64 positions are transposed, then word k of a block holds the
+ * individuals of universe k. The hashes of the universes for a cycle detection come from a bit-sliced CRC, which
+ * transposes only its shift register.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_MULTIVERSE_HPP_AP_19102026
+#define HEADER_MULTIVERSE_HPP_AP_19102026
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "boardAllocator.hpp"
+#include "lifeCycle.hpp"
+#include "lifeRule.hpp"
+#include "workerPool.hpp"
+
+
+namespace GameOfLife
+{
+/** @class Multiverse
+ *  @brief Up to 256 independent biotopes of rows x columns individuals with the same rule.
+ */
+class Multiverse
+{
+public:
+        static constexpr int max_universes = 256;
+
+        Multiverse(int rows, int columns, int universes, const struct_rule &rule = conway_rule, int threads = 1);
+        virtual ~Multiverse();				// Virtual Destructor.
+
+        // Copies the individuals of a life cycle with the same size into one universe, e.g. a soup of
+        // LifeCycle::Restart(seed, live_rate).
+        void Load(int universe, const LifeCycle &lifecycle);
+
+        // Copies one universe into a life cycle with the same size, as a new pattern in generation 0.
+        void Store(int universe, LifeCycle &lifecycle) const;
+
+        void Step(int generations);
+
+        uint64_t Population(int universe) const;
+        void Populations(std::vector<uint64_t> &populations) const;
+
+        // A hash of every universe for a cycle detection, 0 for an empty universe.
+        void Hashes(std::vector<uint64_t> &hashes) const;
+
+        // True, if the universe changed in the last generation. A universe without changes is a still life.
+        bool Changed(int universe) const { return (_changed[universe / 64] >> (universe % 64)) & 1; }
+
+        bool IsAlive(int universe, int row, int column) const;
+        int Universes() const { return _universes; }
+        int Rows() const { return _rows; }
+        int Columns() const { return _columns; }
+        uint64_t Generation() const { return _generation; }
+
+private:
+        template<int Lanes, bool Conway> void StepRows(int begin, int end);
+
+        // Words of the position (row, column), the frame included: row and column -1 to rows and columns.
+        inline size_t Position(int row, int column) const
+        {
+            return ((size_t) (row + 1) * (_columns + 2) + column + 1) * _lanes;
+        }
+
+        int _rows, _columns, _universes, _lanes;
+        struct_rule _rule;
+
+        board_vector<uint64_t> _cells[2];
+        int _front;
+        uint64_t _generation;
+
+        // Universes, which changed in the last generation, per row and for the whole board.
+        std::vector<uint64_t> _row_changed, _changed;
+
+        std::unique_ptr<WorkerPool> _pool;
+};
+}
+
+#endif // HEADER_MULTIVERSE_HPP_AP_19102026
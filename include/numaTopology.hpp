@@ -0,0 +1,54 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    numaTopology.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   NUMA nodes and CPUs of the machine, and the CPU of each worker thread.
+ *
+ * The topology is read from /sys/devices/system/node, limited to the CPUs the process may run on. Without that
+ * information all CPUs form one node.
+ *
+ * Pinning policies: "none" leaves the threads to the scheduler, "compact" fills one node after the other (the
+ * threads share the memory of as few nodes as possible), "scatter" deals the threads out to the nodes in turn (all
+ * memory controllers are used with few threads already).
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_NUMATOPOLOGY_HPP_AP_19102026
+#define HEADER_NUMATOPOLOGY_HPP_AP_19102026
+
+#include <string>
+#include <vector>
+
+
+namespace GameOfLife
+{
+/** @class NumaTopology
+ *  @brief Reads the NUMA nodes and chooses the CPUs for the worker threads.
+ */
+class NumaTopology
+{
+public:
+        NumaTopology();
+        virtual ~NumaTopology();				// Virtual Destructor.
+
+        // CPU for each of the threads, empty for the policy "none" or an unknown policy.
+        std::vector<int> PinOrder(std::string policy, int threads) const;
+
+        // Like "2 NUMA nodes: node 0 (CPUs 0-7), node 1 (CPUs 8-15)".
+        std::string Describe() const;
+
+        int Nodes() const { return _node_cpus.size(); }
+        int NodeOfCpu(int cpu) const;
+
+private:
+        std::vector<std::vector<int>> _node_cpus;
+};
+}
+
+#endif // HEADER_NUMATOPOLOGY_HPP_AP_19102026
@@ -0,0 +1,164 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    profiler.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Scoped timers for the hot path and export as Chrome trace events.
+ *
+ * This program part measures the duration of the single phases of a frame (life rules, grid update, event handling,
+ * drawing, ...). Every thread writes its samples into its own lock-free buffer. The buffers are drained periodically
+ * and written as a Chrome trace-event JSON file, which can be opened in chrome://tracing or https://ui.perfetto.dev.
+ * Without the CMake option GAME_ENABLE_PROFILING all timers are compiled out.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_PROFILER_HPP_AP_19102026
+#define HEADER_PROFILER_HPP_AP_19102026
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cmake_config.h"
+
+
+namespace GameOfLife
+{
+    struct struct_trace_sample
+    {
+        const char *name;
+        uint64_t start_ns, duration_ns;
+    };
+
+/** @class TraceBuffer
+ *  @brief Single producer / single consumer ring buffer of one thread.
+ *
+ *  The owning thread pushes the samples, the exporting thread pops them. Both sides only synchronize over the two
+ *  atomic indices, so the hot path never takes a lock. If the exporter is too slow, new samples are dropped.
+ */
+class TraceBuffer
+{
+public:
+        TraceBuffer(int thread_id);
+
+        inline void Push(const char *name, uint64_t start_ns, uint64_t duration_ns)
+        {
+            uint32_t head = _head.load(std::memory_order_relaxed);
+
+            if (head - _tail.load(std::memory_order_acquire) >= capacity)
+            {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            samples[head & (capacity - 1)] = {name, start_ns, duration_ns};
+            _head.store(head + 1, std::memory_order_release);
+        }
+
+        template <typename Function>
+        void Drain(Function function)
+        {
+            uint32_t tail = _tail.load(std::memory_order_relaxed);
+            uint32_t head = _head.load(std::memory_order_acquire);
+
+            for (; tail != head; tail++)
+            {
+                function(samples[tail & (capacity - 1)]);
+            }
+
+            _tail.store(tail, std::memory_order_release);
+        }
+
+        static constexpr uint32_t capacity = 1u << 16;     // Has to be a power of two.
+
+        int thread_id;
+        std::atomic<uint64_t> dropped;
+
+private:
+        std::vector<struct_trace_sample> samples;
+        std::atomic<uint32_t> _head, _tail;
+};
+
+/** @class Profiler
+ *  @brief Collects the samples of all threads and writes the trace file.
+ *
+ *  There is only one profiler in the program. Each thread registers its buffer on its first sample. Flush() has to be
+ *  called from one thread only, e.g. every few frames from the main loop.
+ */
+class Profiler
+{
+public:
+        static Profiler &Instance();
+
+        void Open(std::string trace_file_name);
+        void Flush();
+        void Close();
+
+        inline uint64_t Now() const
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                                          _epoch).count();
+        }
+
+        inline TraceBuffer &LocalBuffer()
+        {
+            thread_local TraceBuffer *buffer = this->RegisterThread();
+            return *buffer;
+        }
+
+private:
+        Profiler();
+        ~Profiler();
+
+        TraceBuffer *RegisterThread();
+
+        std::chrono::steady_clock::time_point _epoch;
+
+        std::mutex _registry_mutex;
+        std::vector<TraceBuffer *> _buffers;
+
+        FILE *_trace_file;
+        bool _first_event;
+};
+
+/** @class ScopedTimer
+ *  @brief Measures the time between construction and destruction and pushes it to the thread local buffer.
+ */
+class ScopedTimer
+{
+public:
+        inline ScopedTimer(const char *name) : _name(name), _start(Profiler::Instance().Now()) {}
+
+        inline ~ScopedTimer()
+        {
+            Profiler &profiler = Profiler::Instance();
+            profiler.LocalBuffer().Push(_name, _start, profiler.Now() - _start);
+        }
+
+private:
+        const char *_name;
+        uint64_t _start;
+};
+
+}
+
+// Use only string literals as names, the buffers store the pointer and not the string itself.
+#ifdef GAME_ENABLE_PROFILING
+#define GOL_PROFILE_CONCAT_IMPL(a, b) a##b
+#define GOL_PROFILE_CONCAT(a, b) GOL_PROFILE_CONCAT_IMPL(a, b)
+#define GOL_PROFILE_SCOPE(name) GameOfLife::ScopedTimer GOL_PROFILE_CONCAT(gol_scoped_timer_, __LINE__)(name)
+#else
+#define GOL_PROFILE_SCOPE(name) ((void) 0)
+#endif
+
+
+#endif // HEADER_PROFILER_HPP_AP_19102026
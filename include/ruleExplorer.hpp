@@ -0,0 +1,87 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    ruleExplorer.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Screens families of rules of life on the same random soup, without any window.
+ *
+ * A family like B3/S* stands for many rules (here all 512 survival sets). Every rule gets the same soup in the
+ * middle of an empty board and lives until it dies out, repeats itself, reaches the border of the board or the
+ * maximum number of generations. The rules are independent, so they are spread over the worker threads like the
+ * biotopes of the batch mode. Each run is classified by its population, its period and the growth of its bounding
+ * box, and the rules are ranked by how long the soup stays active without exploding.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_RULEEXPLORER_HPP_AP_19102026
+#define HEADER_RULEEXPLORER_HPP_AP_19102026
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "lifeCycle.hpp"
+#include "lifeRule.hpp"
+
+
+namespace GameOfLife
+{
+    enum rule_behaviour
+    {
+        dies_out,                   // The soup is extinct.
+        still,                      // The soup settles into still lifes.
+        oscillating,                // The soup settles into oscillators with a period of 2 or more.
+        chaotic,                    // No repetition until the maximum number of generations, inside of the board.
+        explosive                   // The soup grows into the border of the board.
+    };
+
+    struct struct_rule_result
+    {
+        struct_rule rule;
+        rule_behaviour behaviour;
+        uint64_t initial_population, peak_population, final_population;
+        uint64_t active_generations;    // Until the soup died out, repeated itself or reached the border.
+        uint64_t period;
+        double expansion_rate;          // Growth of the bounding box in individuals per generation.
+        double score;
+    };
+
+/** @class RuleExplorer
+ *  @brief Screens families of rules of life on the same random soup, without any window.
+ */
+class RuleExplorer
+{
+public:
+        RuleExplorer(int rows, int columns, int soup_size, int live_rate, unsigned seed);
+        virtual ~RuleExplorer();				// Virtual Destructor.
+
+        // Families separated by commas, e.g. "B3/S*,B36/S23". A "*" stands for every subset of the counts, which are
+        // not listed in its part: B3/S2* are all rules with birth at 3 and survival at 2 and any other counts. Rules
+        // with birth at 0 are left out. Returns the number of rules.
+        int AddRules(std::string families);
+
+        void Run(int threads, int max_generations, int cycle_window);
+
+        // Ranked table of the best "top" rules. With an output file, all rules are written as CSV.
+        void Report(int top, std::string output_file);
+
+        std::vector<struct_rule_result> results;
+
+private:
+        void RunRule(struct_rule_result &result, int worker, int max_generations, int cycle_window);
+
+        int _rows, _columns, _live_rate;
+        std::vector<struct_cell_change> _soup;
+
+        // One life cycle per worker, which is restarted for every rule instead of allocated again.
+        std::vector<std::unique_ptr<LifeCycle>> _universes;
+};
+}
+
+#endif // HEADER_RULEEXPLORER_HPP_AP_19102026
@@ -0,0 +1,106 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    sharedState.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Export of the biotope into POSIX shared memory.
+ *
+ * After every generation the biotope is written bit-packed into the next frame of a ring in shared memory. Other
+ * processes on the same machine map the ring and read the frames without copying them through a pipe or socket.
+ * Every frame is protected by a sequence lock: the writer never waits, a reader repeats its read, if the frame was
+ * overwritten in the meantime.
+ *
+ * Layout: struct_shared_header, followed by "slots" times (struct_shared_frame + frame_bytes). A frame contains
+ * "rows" rows of "words_per_row" 64 bit words, bit c of word w in row r is the individual in column 64 * w + c.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_SHAREDSTATE_HPP_AP_19102026
+#define HEADER_SHAREDSTATE_HPP_AP_19102026
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace GameOfLife
+{
+    class LifeCycle;
+
+    static constexpr char shared_state_magic[8] = "GOLSHM1";
+
+    struct alignas(64) struct_shared_header
+    {
+        char magic[8];
+        uint32_t slots, rows, columns, words_per_row;
+        uint64_t frame_bytes, slot_bytes;
+        std::atomic<uint64_t> published;        // Number of published frames. The newest is (published - 1) % slots.
+    };
+
+    struct alignas(64) struct_shared_frame
+    {
+        std::atomic<uint64_t> sequence;         // Odd while the frame is written.
+        uint64_t generation, population;
+    };
+
+    // Header and rows of a slot of the ring.
+    inline struct_shared_frame *FrameHeader(const struct_shared_header *header, uint64_t slot)
+    {
+        return (struct_shared_frame *) ((char *) header + sizeof(struct_shared_header) + slot * header->slot_bytes);
+    }
+
+    inline uint64_t *FrameData(const struct_shared_header *header, uint64_t slot)
+    {
+        return (uint64_t *) (FrameHeader(header, slot) + 1);
+    }
+
+/** @class SharedStateExporter
+ *  @brief Writer of the ring in shared memory.
+ *
+ *  A frame slot is only brought up to date with the tiles, which changed since the frame was written the last time.
+ */
+class SharedStateExporter
+{
+public:
+        SharedStateExporter(std::string name, int slots, const LifeCycle &lifecycle);
+        virtual ~SharedStateExporter();				// Virtual Destructor.
+
+        bool IsOpen() const { return _header != nullptr; }
+        void Publish(const LifeCycle &lifecycle);
+
+private:
+        std::string _name;
+        size_t _size;
+
+        struct_shared_header *_header;
+
+        std::vector<uint64_t> _slot_stamp;          // Change stamp of the life cycle, when the slot was written.
+};
+
+/** @class SharedStateReader
+ *  @brief Reader of the ring in shared memory, for external tools.
+ */
+class SharedStateReader
+{
+public:
+        SharedStateReader(std::string name);
+        virtual ~SharedStateReader();				// Virtual Destructor.
+
+        bool IsOpen() const { return _header != nullptr; }
+        bool ReadLatest(std::vector<uint64_t> &frame, uint64_t &generation, uint64_t &population);
+
+        const struct_shared_header *header() const { return _header; }
+
+private:
+        size_t _size;
+        const struct_shared_header *_header;
+};
+}
+
+#endif // HEADER_SHAREDSTATE_HPP_AP_19102026
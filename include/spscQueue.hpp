@@ -0,0 +1,117 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    spscQueue.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Bounded lock-free queue between exactly one producer thread and one consumer thread.
+ *
+ * The queue is a ring of a power of two slots. The producer only writes the tail, the consumer only writes the head,
+ * both indices lie on their own cache line. Each side keeps a copy of the index of the other side and only reloads
+ * it, when the ring looks full or empty. A full queue is the backpressure: TryPush() fails and the producer has to
+ * wait, until the consumer caught up.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_SPSCQUEUE_HPP_AP_19102026
+#define HEADER_SPSCQUEUE_HPP_AP_19102026
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "boardAllocator.hpp"
+
+
+namespace GameOfLife
+{
+/** @class SpscQueue
+ *  @brief Bounded queue of values of type T for one producer and one consumer.
+ */
+template<class T>
+class SpscQueue
+{
+public:
+        // The capacity is rounded up to a power of two.
+        SpscQueue(size_t capacity) : _head(0), _tail(0), _cached_head(0), _cached_tail(0)
+        {
+            size_t size = 1;
+
+            while (size < capacity)
+            {
+                size *= 2;
+            }
+
+            _slots.resize(size);
+            _mask = size - 1;
+        }
+
+        // Producer only. The value is only moved away, if there was room for it.
+        bool TryPush(T &&value)
+        {
+            size_t tail = _tail.load(std::memory_order_relaxed);
+
+            if (tail - _cached_head > _mask)
+            {
+                _cached_head = _head.load(std::memory_order_acquire);
+
+                if (tail - _cached_head > _mask)
+                {
+                    return false;
+                }
+            }
+
+            _slots[tail & _mask] = std::move(value);
+            _tail.store(tail + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        bool TryPush(const T &value)
+        {
+            T copy = value;
+
+            return this->TryPush(std::move(copy));
+        }
+
+        // Consumer only.
+        bool TryPop(T &value)
+        {
+            size_t head = _head.load(std::memory_order_relaxed);
+
+            if (head == _cached_tail)
+            {
+                _cached_tail = _tail.load(std::memory_order_acquire);
+
+                if (head == _cached_tail)
+                {
+                    return false;
+                }
+            }
+
+            value = std::move(_slots[head & _mask]);
+            _head.store(head + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        size_t Capacity() const { return _mask + 1; }
+
+private:
+        std::vector<T> _slots;
+        size_t _mask;
+
+        alignas(cache_line_size) std::atomic<size_t> _head;         // Next slot to read, written by the consumer.
+        alignas(cache_line_size) std::atomic<size_t> _tail;         // Next slot to write, written by the producer.
+
+        alignas(cache_line_size) size_t _cached_head;               // Copy of the producer.
+        alignas(cache_line_size) size_t _cached_tail;               // Copy of the consumer.
+};
+}
+
+#endif // HEADER_SPSCQUEUE_HPP_AP_19102026
@@ -12,6 +12,10 @@
  *
  * This program part is responsible for the visualization of the habitat and individuals. This includes all
  * information regarding the environment and test subject.
+ *
+ * The biotope is seen through a camera, which can be moved with the middle mouse button or the arrow keys and zoomed
+ * with the mouse wheel. The picture is drawn into a texture with the size of the window, so the costs depend on the
+ * number of pixels and not on the size of the biotope. Zoomed out, one pixel shows the density of many individuals.
  */
 // --------------------------------------------------------------------------------------------------------------------
 
@@ -22,11 +26,19 @@
 #include <string>
 #include <vector>
 
+#include "boardAllocator.hpp"
 #include "lifeCycle.hpp"
+#include "densityMipmap.hpp"
 
 
 namespace GameOfLife
 {
+    enum color_mode
+    {
+        grey,       // Living individuals black, dead ones white. Zoomed out: the density as grey value.
+        age         // Colors of a palette by the age of the individuals: births hot, old still lifes cold.
+    };
+
 /** @class Visual2D
  *  @brief Visualization for the Game_of_Life project.
  *
@@ -38,9 +50,17 @@ public:
         Visual2D(int number_of_elements, std::string window_form);
         virtual ~Visual2D();				// Virtual Destructor.
 
-        void GridUpdater(std::vector<struct_individuals> &individuals);
+        void GridUpdater(LifeCycle &lifecycle);
+        void HandleEvent(const sf::Event &event);
+
+        // The mode age needs a life cycle, which keeps the ages of the individuals.
+        void SetColorMode(std::string mode);
 
-	sf::VertexArray biotope_map;
+        // Individual below the pixel (x, y) of the window. False outside of the biotope.
+        bool CellAt(int x, int y, int &row, int &column) const;
+
+	sf::Texture biotope_texture;
+	sf::Sprite biotope_sprite;
 	
         // The resultant number of elements, because of the limitation of the window size.
         int res_num_elements;
@@ -63,9 +83,18 @@ private:
 	void WindowConfigurator();
 	void GridConfigurator();
 	void BiotopeConfigurator();
+	void CreateBuffers();
 	
 	inline int max_num_of_elem (int num_of_elem, int a, int b);
 	inline int get_element_size (int num_of_elem, int a, int b);
+
+	void CameraConfigurator(const LifeCycle &lifecycle);
+	void Zoom(float factor, int x, int y);
+	void Pan(double dx, double dy);
+	void RenderRegion(const LifeCycle &lifecycle, int x0, int y0, int x1, int y1);
+	void RenderTile(const LifeCycle &lifecycle, int slot);
+	void RefreshWarmTiles(const LifeCycle &lifecycle);
+	int DetailLevel() const;
 	
 	uint32_t grid_height;
 	uint32_t grid_width;
@@ -76,6 +105,34 @@ private:
 	
 	std::string _window_form;
 
+	// Camera: the viewport is the part of the window, which shows the biotope. The origin is the position of the
+	// upper left viewport corner in the biotope (in individuals), the scale is the number of pixels per individual.
+	int _viewport_x, _viewport_y, _viewport_width, _viewport_height;
+	double _origin_x, _origin_y, _scale;
+	bool _camera_ready, _view_changed, _pixels_changed;
+	bool _dragging;
+	int _drag_x, _drag_y;
+
+	int _board_rows, _board_columns;
+
+	// RGBA pixels of the whole window and the levels of detail for the zoomed out view.
+	board_vector<sf::Uint8> _pixels;
+	DensityMipmap _mipmap;
+
+	// Change stamp of the life cycle at the last drawing and the tiles, which changed since then.
+	uint64_t _render_stamp;
+	std::vector<int> _changed_slots;
+
+	// Colors of the ages 0 (dead) to 255 as RGBA. Tiles stay warm, until all their individuals have the highest
+	// age: they grow older without changing, so they are drawn again every few frames.
+	color_mode _color_mode;
+	sf::Uint8 _palette[256][4];
+	std::vector<uint8_t> _warm, _queued;
+	std::vector<int> _warm_slots;
+	int _warm_frames;
+
+	static constexpr int warm_refresh_frames = 8;
+
         sf::VideoMode desktop;
 	
         // Lookup table for common screen resolution (https://en.wikipedia.org/wiki/Display_resolution).
@@ -0,0 +1,99 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    workerPool.hpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Persistent worker threads for the parallel parts of the life cycle.
+ *
+ * This program part keeps a fixed number of threads alive for the whole run. The calling thread takes part in the
+ * work as worker 0, so a pool with one thread does not start any additional thread at all. A pinned pool pins the
+ * calling thread only for the duration of a job, any thread can call it.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#ifndef HEADER_WORKERPOOL_HPP_AP_19102026
+#define HEADER_WORKERPOOL_HPP_AP_19102026
+
+#include <sched.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace GameOfLife
+{
+/** @class WorkerPool
+ *  @brief Persistent worker threads for the parallel parts of the life cycle.
+ *
+ *  ParallelFor() splits the range [0, count) into chunks. The workers fetch the chunks one after another, so
+ *  neighbouring indices end up on the same thread.
+ *
+ *  RunTasks() is meant for independent tasks of very different length. Every worker gets its own queue and works it
+ *  off from the back. A worker with an empty queue steals from the front of the other queues.
+ *
+ *  ParallelForStatic() gives every worker always the same part of the range. Together with pinned threads, the memory
+ *  of a part stays on the NUMA node of the worker, which touched it first.
+ */
+class WorkerPool
+{
+public:
+        // With CPUs, worker i runs on cpus[i] only. Worker 0 is the calling thread, while it runs a job.
+        WorkerPool(int threads, std::vector<int> cpus = std::vector<int>());
+        virtual ~WorkerPool();				// Virtual Destructor.
+
+        void ParallelFor(int count, int grain, std::function<void(int begin, int end, int worker)> function);
+        void ParallelForStatic(int count, std::function<void(int begin, int end, int worker)> function);
+        void RunTasks(int count, std::function<void(int task, int worker)> function);
+
+        int Size() const { return _threads; }
+        bool Pinned() const { return !_cpus.empty(); }
+
+private:
+        void WorkerLoop(int worker);
+        void Dispatch(std::function<void(int begin, int end, int worker)> &function, int count, int grain,
+                      bool fixed_parts);
+        void RunChunks(int worker);
+        void PinCaller();
+        void RestoreCaller();
+        bool PopTask(int worker, int &task);
+
+        struct struct_task_queue
+        {
+            std::mutex mutex;
+            std::deque<int> tasks;
+        };
+
+        int _threads;
+        std::vector<std::thread> _workers;
+        std::vector<int> _cpus;
+
+        // CPUs of the calling thread before the job.
+        cpu_set_t _caller_cpus;
+
+        std::mutex _mutex;
+        std::condition_variable _start_condition, _done_condition;
+        uint64_t _job_generation;
+        int _busy_workers;
+        bool _shutdown;
+
+        // The current job.
+        std::function<void(int, int, int)> _function;
+        std::atomic<int> _next_index;
+        int _count, _grain;
+        bool _fixed_parts;
+
+        std::vector<std::unique_ptr<struct_task_queue>> _queues;
+};
+}
+
+#endif // HEADER_WORKERPOOL_HPP_AP_19102026
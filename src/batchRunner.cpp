@@ -0,0 +1,419 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    batchRunner.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Runs many small biotopes in one process without any window.
+ *
+ * This program part creates the biotopes, runs them on the worker pool and writes one table with the aggregated
+ * results per live rate and optionally a CSV file with one line per biotope.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+
+#include "batchRunner.hpp"
+#include "cycleDetector.hpp"
+#include "fixedLifeCycle.hpp"
+#include "lifeCycle.hpp"
+#include "multiverse.hpp"
+#include "workerPool.hpp"
+
+
+namespace GameOfLife
+{
+
+/** @fn BatchRunner::BatchRunner()
+ *  @brief Constructor of the class BatchRunner.
+ *
+ */
+BatchRunner::BatchRunner(int rows, int columns, int runs_per_rate, int live_rate_min, int live_rate_max,
+                         int live_rate_step, std::string rule)
+{
+    this->_rows = rows;
+    this->_columns = columns;
+    this->_runs_per_rate = runs_per_rate;
+    this->_rule = rule;
+    this->_fixed = false;
+    this->_multiverse_universes = 0;
+
+    if (live_rate_step < 1)
+    {
+        live_rate_step = 1;
+    }
+
+    for (int live_rate = live_rate_min; live_rate <= live_rate_max; live_rate += live_rate_step)
+    {
+        _live_rates.push_back(live_rate);
+    }
+}
+
+/** @fn BatchRunner::~BatchRunner()
+ *  @brief Destructor of the class BatchRunner.
+ *
+ */
+BatchRunner::~BatchRunner()
+{
+}
+
+/** @fn BatchRunner::EnableMultiverse(int universes)
+ *  @brief Steps up to 256 biotopes per thread together as universes of a multiverse.
+ */
+void BatchRunner::EnableMultiverse(int universes)
+{
+    _multiverse_universes = std::max(0, std::min(universes, (int) Multiverse::max_universes));
+}
+
+/** @fn BatchRunner::Run(int threads, int max_generations, int cycle_window, unsigned first_seed)
+ *  @brief Runs all biotopes. Each biotope gets its own seed, so every run can be repeated on its own.
+ */
+void BatchRunner::Run(int threads, int max_generations, int cycle_window, unsigned first_seed)
+{
+    results.resize(_live_rates.size() * _runs_per_rate);
+
+    for (int i = 0; i < results.size(); i++)
+    {
+        results[i].live_rate = _live_rates[i / _runs_per_rate];
+        results[i].seed = first_seed + i;
+    }
+
+    fprintf(stdout,"Batch run of %lu biotopes with %i x %i individuals on %i threads.\n",
+            (unsigned long) results.size(), _rows, _columns, threads);
+
+    _fixed = _multiverse_universes == 0 && CreateFixedLifeCycle(_rows, _columns, _rule, 1) != nullptr;
+
+    if (_multiverse_universes > 0)
+    {
+        fprintf(stdout,"The biotopes are stepped bit-sliced, %i at once per thread.\n", _multiverse_universes);
+    }
+    else if (_fixed)
+    {
+        fprintf(stdout,"The biotopes are stepped by the fixed life cycle for this size and the rule %s.\n",
+                _rule.c_str());
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::atomic<int> finished(0);
+
+    WorkerPool pool(threads);
+
+    _universes.clear();
+    _universes.resize(pool.Size());
+    _fixed_universes.clear();
+    _fixed_universes.resize(pool.Size());
+    _multiverses.clear();
+    _multiverses.resize(pool.Size());
+
+    if (_multiverse_universes > 0)
+    {
+        // One multiverse per worker, which takes the next biotope, whenever one of its universes is idle.
+        std::atomic<int> next(0);
+
+        pool.RunTasks(pool.Size(), [&](int task, int worker)
+        {
+            this->RunMultiverse(next, finished, worker, max_generations, cycle_window);
+        });
+    }
+    else
+    {
+        pool.RunTasks(results.size(), [&](int task, int worker)
+        {
+            if (_fixed)
+            {
+                this->RunFixedUniverse(results[task], worker, max_generations, cycle_window);
+            }
+            else
+            {
+                this->RunUniverse(results[task], worker, max_generations, cycle_window);
+            }
+
+            this->Progress(finished, worker);
+        });
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    fprintf(stdout,"\rFinished %lu biotopes in %.3f s.\n", (unsigned long) results.size(), seconds);
+}
+
+void BatchRunner::RunUniverse(struct_batch_result &result, int worker, int max_generations, int cycle_window)
+{
+    // The worker creates its life cycle itself, so the memory is first touched by the thread, which uses it.
+    if (!_universes[worker])
+    {
+        _universes[worker].reset(new LifeCycle(_rows, _columns, _rows * _columns, "empty", " ", result.live_rate,
+                                               false));
+        _universes[worker]->SetRule(_rule);
+        _universes[worker]->SetCycleDetection("halt", cycle_window);
+        _universes[worker]->SetMaxGenerations(max_generations);
+    }
+
+    LifeCycle &lifecycle = *_universes[worker];
+
+    lifecycle.Restart(result.seed, result.live_rate);
+
+    result.initial_population = lifecycle.Population();
+
+    while (!lifecycle.Halted() && lifecycle.Population() > 0)
+    {
+        lifecycle.LifeRules();
+    }
+
+    Finish(result, lifecycle.Population(), lifecycle.Generation(), lifecycle.Cycle());
+}
+
+/** @fn BatchRunner::RunFixedUniverse(struct_batch_result &result, int worker, int max_generations, int cycle_window)
+ *  @brief Runs one biotope with the fixed life cycle, with the same stops as the LifeCycle in RunUniverse().
+ */
+void BatchRunner::RunFixedUniverse(struct_batch_result &result, int worker, int max_generations, int cycle_window)
+{
+    if (!_fixed_universes[worker])
+    {
+        _universes[worker].reset(new LifeCycle(_rows, _columns, _rows * _columns, "empty", " ", result.live_rate,
+                                               false));
+        _fixed_universes[worker] = CreateFixedLifeCycle(_rows, _columns, _rule, 1);
+    }
+
+    LifeCycle &seeder = *_universes[worker];
+    FixedBoard &universe = *_fixed_universes[worker];
+    CycleDetector detector(cycle_window);
+
+    seeder.Restart(result.seed, result.live_rate);
+    universe.Load(seeder);
+    detector.Update(universe.Generation(), universe.Hash());
+
+    result.initial_population = universe.Population();
+
+    while (universe.Population() > 0)
+    {
+        universe.Step(1);
+
+        if (detector.Update(universe.Generation(), universe.Hash()) || universe.Generation() >= max_generations)
+        {
+            break;
+        }
+    }
+
+    Finish(result, universe.Population(), universe.Generation(), detector.cycle);
+}
+
+/** @fn BatchRunner::RunMultiverse(std::atomic<int> &next, std::atomic<int> &finished, int worker, ...)
+ *  @brief Runs the biotopes as universes of a multiverse, with the same stops as RunUniverse().
+ *
+ *  Every universe has its own cycle detection and counts its generations from the one, in which it was loaded. When
+ *  a biotope stops, its universe is loaded with the next biotope in the same generation, so the universes do not wait
+ *  for the slowest biotope of a group. Idle universes at the end are stepped along, but not looked at any more.
+ */
+void BatchRunner::RunMultiverse(std::atomic<int> &next, std::atomic<int> &finished, int worker, int max_generations,
+                                int cycle_window)
+{
+    int universes = std::min<int>(_multiverse_universes, results.size());
+
+    if (!_multiverses[worker])
+    {
+        struct_rule rule = conway_rule;
+        ParseRule(_rule, rule);
+
+        _universes[worker].reset(new LifeCycle(_rows, _columns, _rows * _columns, "empty", " ",
+                                               results[0].live_rate, false));
+        _multiverses[worker].reset(new Multiverse(_rows, _columns, universes, rule));
+    }
+
+    LifeCycle &seeder = *_universes[worker];
+    Multiverse &multiverse = *_multiverses[worker];
+
+    // The biotope of every universe (-1 for an idle one), its first generation and the last checked generation.
+    std::vector<int> biotopes(universes, -1);
+    std::vector<uint64_t> starts(universes, 0), checked(universes, 0), hashes;
+    std::vector<CycleDetector> detectors(universes, CycleDetector(cycle_window));
+    int running = 0;
+
+    while (true)
+    {
+        for (int i = 0; i < universes && next < (int) results.size(); i++)
+        {
+            int biotope = biotopes[i] < 0 ? next++ : -1;
+
+            if (biotope >= 0 && biotope < (int) results.size())
+            {
+                seeder.Restart(results[biotope].seed, results[biotope].live_rate);
+                multiverse.Load(i, seeder);
+
+                results[biotope].initial_population = seeder.Population();
+                biotopes[i] = biotope;
+                starts[i] = multiverse.Generation();
+                checked[i] = UINT64_MAX;
+                detectors[i].Reset();
+                running++;
+            }
+        }
+
+        if (running == 0)
+        {
+            break;
+        }
+
+        multiverse.Hashes(hashes);
+
+        bool idle = false;
+
+        for (int i = 0; i < universes; i++)
+        {
+            if (biotopes[i] < 0 || checked[i] == multiverse.Generation())
+            {
+                continue;
+            }
+
+            uint64_t generation = multiverse.Generation() - starts[i];
+            checked[i] = multiverse.Generation();
+
+            // Only an empty universe has the hash 0, but a CRC of 0 is possible, so the population decides.
+            bool extinct = hashes[i] == 0 && multiverse.Population(i) == 0;
+            bool cycle = detectors[i].Update(generation, hashes[i]);
+
+            if (extinct || (generation > 0 && (cycle || generation >= max_generations)))
+            {
+                Finish(results[biotopes[i]], multiverse.Population(i), generation, detectors[i].cycle);
+
+                biotopes[i] = -1;
+                running--;
+                idle = true;
+
+                this->Progress(finished, worker);
+            }
+        }
+
+        // New biotopes start in this generation, so they are loaded and checked before the next step.
+        if (!(idle && next < (int) results.size()))
+        {
+            multiverse.Step(1);
+        }
+    }
+}
+
+/** @fn BatchRunner::Progress(std::atomic<int> &finished, int worker)
+ *  @brief Counts a finished biotope. The first worker shows the progress.
+ */
+void BatchRunner::Progress(std::atomic<int> &finished, int worker)
+{
+    int done = ++finished;
+
+    if (worker == 0)
+    {
+        fprintf(stdout,"\rFinished %i of %lu biotopes.", done, (unsigned long) results.size());
+        fflush(stdout);
+    }
+}
+
+/** @fn BatchRunner::Finish(struct_batch_result &result, uint64_t population, uint64_t generation, ...)
+ *  @brief Stores the end of a biotope and the reason, why it stopped.
+ */
+void BatchRunner::Finish(struct_batch_result &result, uint64_t population, uint64_t generation,
+                         const struct_cycle &cycle)
+{
+    result.final_population = population;
+    result.generations = generation;
+    result.period = cycle.period;
+    result.onset = cycle.onset;
+
+    if (population == 0)
+    {
+        result.reason = batch_stop::extinct;
+    }
+    else if (cycle.detected)
+    {
+        result.reason = batch_stop::stabilized;
+    }
+    else
+    {
+        result.reason = batch_stop::generation_limit;
+    }
+}
+
+/** @fn BatchRunner::Report(std::string output_file)
+ *  @brief Prints the results per live rate. With an output file, all single results are written as CSV.
+ */
+void BatchRunner::Report(std::string output_file)
+{
+    fprintf(stdout,"\n%9s %6s %9s %11s %9s %13s %13s %11s\n", "live_rate", "runs", "extinct", "stabilized",
+            "limit", "mean_onset", "mean_final", "density");
+
+    for (int live_rate : _live_rates)
+    {
+        int runs = 0, extinct = 0, stable = 0, limit = 0;
+        double onset = 0.0, final_population = 0.0;
+
+        for (const struct_batch_result &result : results)
+        {
+            if (result.live_rate != live_rate)
+            {
+                continue;
+            }
+
+            runs++;
+            final_population += result.final_population;
+
+            switch(result.reason)
+            {
+                case batch_stop::extinct :
+                    extinct++;
+                    break;
+                case batch_stop::stabilized :
+                    stable++;
+                    onset += result.onset;
+                    break;
+                default:
+                    limit++;
+                    break;
+            }
+        }
+
+        if (runs == 0)
+        {
+            continue;
+        }
+
+        fprintf(stdout,"%8i%% %6i %8.1f%% %10.1f%% %8.1f%% %13.1f %13.1f %10.3f%%\n", live_rate, runs,
+                100.0 * extinct / runs, 100.0 * stable / runs, 100.0 * limit / runs,
+                stable > 0 ? onset / stable : 0.0, final_population / runs,
+                100.0 * final_population / runs / ((double) _rows * _columns));
+    }
+
+    if (output_file.empty())
+    {
+        return;
+    }
+
+    FILE *file = fopen(output_file.c_str(), "w");
+
+    if (file == NULL)
+    {
+        fprintf(stdout,"Cannot open the batch output file %s.\n", output_file.c_str());
+        return;
+    }
+
+    static const char *reasons[] = {"extinct", "stabilized", "generation_limit"};
+
+    fprintf(file, "live_rate,seed,reason,initial_population,final_population,generations,period,onset\n");
+
+    for (const struct_batch_result &result : results)
+    {
+        fprintf(file, "%i,%u,%s,%lu,%lu,%lu,%lu,%lu\n", result.live_rate, result.seed, reasons[result.reason],
+                (unsigned long) result.initial_population, (unsigned long) result.final_population,
+                (unsigned long) result.generations, (unsigned long) result.period, (unsigned long) result.onset);
+    }
+
+    fclose(file);
+
+    fprintf(stdout,"The results of all biotopes were written to %s.\n", output_file.c_str());
+}
+
+}
@@ -0,0 +1,400 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    benchmark.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Measures the speed of the life cycle without any window.
+ *
+ * This program steps the same random soup with every kernel and step mode and prints the generations and cell
+ * updates per second. Usage:
+ * Game_of_Life_Benchmark [rows] [columns] [generations] [threads] [live_rate] [pinning] [huge_pages]
+ *
+ * Every run is done twice: with pages of 4 kB and with the huge pages (transparent or explicit, see
+ * boardAllocator.hpp). The columns "huge MB" and "dTLB misses" show the memory backed by huge pages and the misses
+ * of the data TLB on loads during the measured generations.
+ *
+ * For the sizes with a compile-time specialization (see fixedLifeCycle.hpp) the fixed life cycle runs as well.
+ *
+ * At last many small biotopes of 128 x 128 individuals are stepped one by one and bit-sliced as universes of a
+ * multiverse (see multiverse.hpp). Both use the same number of threads, so the speedup is the one of the bit slices.
+ *
+ * The global allocator is replaced by a counting one. Stepping should not allocate at all, the column "allocs" shows
+ * the calls during the measured generations. The run "active+edges" adds the edge monitor (see edgeMonitor.hpp).
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "cmake_config.h"
+#include "boardAllocator.hpp"
+#include "lifeCycle.hpp"
+#include "fixedLifeCycle.hpp"
+#include "multiverse.hpp"
+#include "workerPool.hpp"
+
+
+// Calls of the global allocator, by any thread.
+static std::atomic<uint64_t> allocation_count(0);
+
+void *operator new(size_t size)
+{
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    void *memory = malloc(size > 0 ? size : 1);
+
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void *memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void *memory, size_t size) noexcept
+{
+    free(memory);
+}
+
+void operator delete[](void *memory, size_t size) noexcept
+{
+    free(memory);
+}
+
+/** @fn OpenTlbCounter()
+ *  @brief Counts the misses of the data TLB on loads in user space, by this thread and all threads started later.
+ *
+ *  Returns -1, if the processor or the kernel (see /proc/sys/kernel/perf_event_paranoid) does not allow it.
+ */
+static int OpenTlbCounter()
+{
+    struct perf_event_attr attributes;
+    memset(&attributes, 0, sizeof attributes);
+
+    attributes.size = sizeof attributes;
+    attributes.type = PERF_TYPE_HW_CACHE;
+    attributes.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attributes.disabled = 1;
+    attributes.inherit = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+
+    return (int) syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+}
+
+static void StartTlbCounter(int counter)
+{
+    if (counter >= 0)
+    {
+        ioctl(counter, PERF_EVENT_IOC_RESET, 0);
+        ioctl(counter, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+static void StopTlbCounter(int counter)
+{
+    if (counter >= 0)
+    {
+        ioctl(counter, PERF_EVENT_IOC_DISABLE, 0);
+    }
+}
+
+/** @fn ReadTlbCounter(int counter)
+ *  @brief Reads and closes the counter, "n/a" without a counter.
+ */
+static std::string ReadTlbCounter(int counter)
+{
+    if (counter < 0)
+    {
+        return "n/a";
+    }
+
+    uint64_t misses = 0;
+    bool valid = read(counter, &misses, sizeof misses) == sizeof misses;
+    close(counter);
+
+    return valid ? std::to_string(misses) : "n/a";
+}
+
+/** @fn HugePageKilobytes()
+ *  @brief Memory of the process, which is backed by transparent or explicit huge pages.
+ */
+static uint64_t HugePageKilobytes()
+{
+    FILE *file = fopen("/proc/self/smaps_rollup", "r");
+
+    if (file == nullptr)
+    {
+        return 0;
+    }
+
+    char text[256];
+    uint64_t kilobytes = 0;
+
+    while (fgets(text, sizeof text, file) != nullptr)
+    {
+        unsigned long value;
+
+        if (sscanf(text, "AnonHugePages: %lu kB", &value) == 1 || sscanf(text, "Private_Hugetlb: %lu kB", &value) == 1)
+        {
+            kilobytes += value;
+        }
+    }
+
+    fclose(file);
+
+    return kilobytes;
+}
+
+int main (int argc, char *argv[])
+{
+	fprintf(stdout,"%s Benchmark -- Version %d.%d\n", GAME_PROJECT_NAME, GAME_VERSION_MAJOR, GAME_VERSION_MINOR);
+
+        int rows = argc > 1 ? atoi(argv[1]) : 2048;
+        int columns = argc > 2 ? atoi(argv[2]) : 2048;
+        int generations = argc > 3 ? atoi(argv[3]) : 200;
+        int threads = argc > 4 ? atoi(argv[4]) : 1;
+        int live_rate = argc > 5 ? atoi(argv[5]) : 20;
+        std::string pinning = argc > 6 ? argv[6] : "none";
+        std::string huge_pages = argc > 7 ? argv[7] : "transparent";
+
+        const char *kernels[] = {"bitwise", "lookup_table"};
+        const char *step_modes[] = {"full_sweep", "active_tiles", "adaptive", "events"};
+
+        // Runs of the step modes, the last one with the edge monitor, which checks the border after each generation.
+        struct struct_run
+        {
+            const char *step_mode, *label;
+            bool edges;
+        };
+
+        std::vector<struct_run> runs;
+
+        for (const char *step_mode : step_modes)
+        {
+            runs.push_back({step_mode, step_mode, false});
+        }
+
+        runs.push_back({"active_tiles", "active+edges", true});
+
+        // First with pages of 4 kB as reference, then with the chosen huge pages.
+        std::vector<std::string> page_modes = {"none"};
+
+        if (huge_pages != "none")
+        {
+            page_modes.push_back(huge_pages);
+        }
+
+        // The life cycle reports its settings, so the table is printed at the end.
+        std::vector<std::string> results;
+        char line[256];
+
+        for (const std::string &page_mode : page_modes)
+        {
+            GameOfLife::SetHugePages(page_mode);
+
+            for (const char *kernel : kernels)
+            {
+                for (const struct_run &run : runs)
+                {
+                    // The workers inherit the counter, so it is opened before the life cycle starts them.
+                    int counter = OpenTlbCounter();
+                    uint64_t population, allocations, huge_kb;
+                    double seconds;
+
+                    {
+                        GameOfLife::LifeCycle lifecycle(rows, columns, rows * columns, "empty", " ", live_rate);
+
+                        lifecycle.SetThreads(threads, pinning);
+                        lifecycle.SetStepMode(run.step_mode);
+                        lifecycle.SetKernel(kernel);
+
+                        if (run.edges)
+                        {
+                            lifecycle.EnableEdgeMonitor(16);
+                        }
+
+                        // The same soup for every run.
+                        lifecycle.SetSeed(42);
+                        lifecycle.RandomPatternGenerator();
+
+                        allocations = allocation_count;
+                        StartTlbCounter(counter);
+                        auto start = std::chrono::steady_clock::now();
+
+                        for (int i = 0; i < generations; i++)
+                        {
+                            lifecycle.LifeRules();
+                        }
+
+                        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                        StopTlbCounter(counter);
+                        allocations = allocation_count - allocations;
+                        population = lifecycle.Population();
+                        huge_kb = HugePageKilobytes();
+                    }
+
+                    // The counts of the workers are only added, when they have finished.
+                    snprintf(line, sizeof line, "%-14s %-14s %-12s %12.1f %14.1f %12lu %8lu %10lu %14s\n", kernel,
+                             run.label, page_mode.c_str(), generations / seconds,
+                             (double) rows * columns * generations / seconds / 1e6, (unsigned long) population,
+                             (unsigned long) allocations, (unsigned long) (huge_kb / 1024),
+                             ReadTlbCounter(counter).c_str());
+
+                    results.push_back(line);
+                }
+            }
+
+            // The same soup with the size and the rule as compile-time constants.
+            int counter = OpenTlbCounter();
+            uint64_t population, allocations, huge_kb;
+            double seconds;
+
+            {
+                std::unique_ptr<GameOfLife::FixedBoard> fixed = GameOfLife::CreateFixedLifeCycle(rows, columns,
+                                                                                                  "B3/S23", threads);
+
+                if (!fixed)
+                {
+                    if (page_mode == page_modes.front())
+                    {
+                        fprintf(stdout,"\nThere is no fixed life cycle for %i x %i individuals.\n", rows, columns);
+                    }
+
+                    ReadTlbCounter(counter);
+                    continue;
+                }
+
+                GameOfLife::LifeCycle lifecycle(rows, columns, rows * columns, "empty", " ", live_rate, false);
+
+                lifecycle.SetSeed(42);
+                lifecycle.RandomPatternGenerator();
+                fixed->Load(lifecycle);
+
+                allocations = allocation_count;
+                StartTlbCounter(counter);
+                auto start = std::chrono::steady_clock::now();
+
+                fixed->Step(generations);
+
+                seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                StopTlbCounter(counter);
+                allocations = allocation_count - allocations;
+                population = fixed->Population();
+                huge_kb = HugePageKilobytes();
+            }
+
+            snprintf(line, sizeof line, "%-14s %-14s %-12s %12.1f %14.1f %12lu %8lu %10lu %14s\n", "fixed",
+                     "full_sweep", page_mode.c_str(), generations / seconds,
+                     (double) rows * columns * generations / seconds / 1e6, (unsigned long) population,
+                     (unsigned long) allocations, (unsigned long) (huge_kb / 1024), ReadTlbCounter(counter).c_str());
+
+            results.push_back(line);
+        }
+
+        fprintf(stdout,"\nBoard: %i x %i, %i generations, %i threads, live rate %i %%.\n\n", rows, columns,
+                generations, threads, live_rate);
+        fprintf(stdout,"%-14s %-14s %-12s %12s %14s %12s %8s %10s %14s\n", "kernel", "step mode", "pages", "gen/s",
+                "Mcells/s", "population", "allocs", "huge MB", "dTLB misses");
+
+        for (const std::string &result : results)
+        {
+            fprintf(stdout,"%s", result.c_str());
+        }
+
+        // Small biotopes for Monte-Carlo studies: each one is its own soup.
+        const int small_size = 128;
+        const int small_count = 64;
+        double one_by_one = 0.0;
+
+        fprintf(stdout,"\n%i x %i individuals per biotope, %i generations.\n\n", small_size, small_size,
+                generations);
+        fprintf(stdout,"%-26s %12s %14s %10s\n", "engine", "biotope gen/s", "Mcells/s", "speedup");
+
+        {
+            std::vector<std::unique_ptr<GameOfLife::LifeCycle>> biotopes;
+
+            for (int i = 0; i < small_count; i++)
+            {
+                biotopes.emplace_back(new GameOfLife::LifeCycle(small_size, small_size, small_size * small_size,
+                                                                "empty", " ", live_rate, false));
+                biotopes.back()->SetStepMode("full_sweep");
+                biotopes.back()->Restart(i + 1, live_rate);
+            }
+
+            // One biotope per task, like the batch mode.
+            GameOfLife::WorkerPool pool(threads);
+            auto start = std::chrono::steady_clock::now();
+
+            pool.RunTasks(small_count, [&](int task, int worker)
+            {
+                for (int i = 0; i < generations; i++)
+                {
+                    biotopes[task]->LifeRules();
+                }
+            });
+
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            one_by_one = small_count * generations / seconds;
+
+            snprintf(line, sizeof line, "%i life cycles, %i thr.", small_count, threads);
+            fprintf(stdout,"%-26s %12.1f %14.1f %10s\n", line, one_by_one,
+                    one_by_one * small_size * small_size / 1e6, "1.0");
+        }
+
+        for (int universes : {64, GameOfLife::Multiverse::max_universes})
+        {
+            GameOfLife::Multiverse multiverse(small_size, small_size, universes, GameOfLife::conway_rule, threads);
+            GameOfLife::LifeCycle soup(small_size, small_size, small_size * small_size, "empty", " ", live_rate, false);
+
+            for (int i = 0; i < universes; i++)
+            {
+                soup.Restart(i + 1, live_rate);
+                multiverse.Load(i, soup);
+            }
+
+            auto start = std::chrono::steady_clock::now();
+
+            multiverse.Step(generations);
+
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            double rate = universes * generations / seconds;
+
+            snprintf(line, sizeof line, "multiverse of %i, %i thr.", universes, threads);
+            fprintf(stdout,"%-26s %12.1f %14.1f %10.1f\n", line, rate, rate * small_size * small_size / 1e6,
+                    rate / one_by_one);
+        }
+
+	return 0;
+}
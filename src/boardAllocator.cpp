@@ -0,0 +1,154 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    boardAllocator.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Memory for the large buffers, aligned to cache lines and backed by huge pages.
+ *
+ * This program part maps the large buffers with mmap and gives the kernel the hints for the huge pages.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <unordered_map>
+
+#include "boardAllocator.hpp"
+
+
+namespace GameOfLife
+{
+static std::atomic<int> page_mode(transparent_huge_pages);
+
+/** @fn SetHugePages(std::string mode)
+ *  @brief Chooses the pages for the buffers allocated from now on.
+ */
+void SetHugePages(std::string mode)
+{
+    static std::unordered_map<std::string, huge_page_mode> const table =
+        { {"none", huge_page_mode::no_huge_pages},
+        {"transparent", huge_page_mode::transparent_huge_pages},
+        {"explicit", huge_page_mode::explicit_huge_pages} };
+
+    auto it = table.find(mode);
+
+    if (it != table.end())
+    {
+        page_mode = it->second;
+    }
+    else
+    {
+        page_mode = huge_page_mode::transparent_huge_pages;
+        fprintf(stdout,"Cannot find the huge page mode: %s. The program will continue with transparent.\n",
+                mode.c_str());
+    }
+}
+
+huge_page_mode HugePages()
+{
+    return (huge_page_mode) page_mode.load();
+}
+
+/** @fn MappedSize(size_t bytes)
+ *  @brief Size of the mapping of a large buffer, 0 for a small buffer.
+ */
+static size_t MappedSize(size_t bytes)
+{
+    return bytes >= huge_page_size ? (bytes + huge_page_size - 1) & ~(huge_page_size - 1) : 0;
+}
+
+/** @fn AllocateBoard(size_t bytes)
+ *  @brief Allocates a buffer, which starts at a cache line. Large buffers start at a huge page.
+ */
+void *AllocateBoard(size_t bytes)
+{
+    size_t size = MappedSize(bytes);
+
+    if (size == 0)
+    {
+        // aligned_alloc() needs a multiple of the alignment.
+        size_t rounded = std::max(cache_line_size, (bytes + cache_line_size - 1) & ~(cache_line_size - 1));
+        void *memory = aligned_alloc(cache_line_size, rounded);
+
+        if (memory == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        return memory;
+    }
+
+    huge_page_mode mode = HugePages();
+
+    if (mode == huge_page_mode::explicit_huge_pages)
+    {
+        void *memory = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+        if (memory != MAP_FAILED)
+        {
+            return memory;
+        }
+
+        static std::atomic<bool> reported(false);
+
+        if (!reported.exchange(true))
+        {
+            fprintf(stdout,"There are not enough explicit huge pages, transparent huge pages are used instead.\n");
+        }
+    }
+
+    // Map one huge page more and cut off the parts before and after the aligned buffer.
+    char *memory = (char *) mmap(NULL, size + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                                 -1, 0);
+
+    if (memory == MAP_FAILED)
+    {
+        throw std::bad_alloc();
+    }
+
+    char *aligned = (char *) (((uintptr_t) memory + huge_page_size - 1) & ~(uintptr_t) (huge_page_size - 1));
+    size_t head = aligned - memory, tail = huge_page_size - head;
+
+    if (head > 0)
+    {
+        munmap(memory, head);
+    }
+
+    if (tail > 0)
+    {
+        munmap(aligned + size, tail);
+    }
+
+    madvise(aligned, size, mode == huge_page_mode::no_huge_pages ? MADV_NOHUGEPAGE : MADV_HUGEPAGE);
+
+    return aligned;
+}
+
+/** @fn FreeBoard(void *memory, size_t bytes)
+ *  @brief Frees a buffer of AllocateBoard() with the same size.
+ */
+void FreeBoard(void *memory, size_t bytes)
+{
+    size_t size = MappedSize(bytes);
+
+    if (size == 0)
+    {
+        free(memory);
+    }
+    else
+    {
+        munmap(memory, size);
+    }
+}
+
+}
@@ -0,0 +1,375 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    cellEditor.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Painting of individuals and stamping of patterns with the mouse.
+ *
+ * This program part reads the pattern files, turns the mouse events into queued edits and applies them to the life
+ * cycle.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <fstream>
+
+#include "cellEditor.hpp"
+#include "visual2d.hpp"
+
+
+namespace GameOfLife
+{
+/** @fn LoadRunLength(std::ifstream &file, struct_pattern &pattern)
+ *  @brief Reads a pattern like "x = 3, y = 3" followed by "bo$2bo$3o!".
+ */
+static bool LoadRunLength(std::ifstream &file, struct_pattern &pattern)
+{
+    std::string line;
+    bool header = false;
+
+    while (!header && std::getline(file, line))
+    {
+        if (line.compare(0, 2, "#N") == 0 && line.find_first_not_of(" \t\r", 2) != std::string::npos)
+        {
+            pattern.name = line.substr(line.find_first_not_of(" \t", 2));
+        }
+        else if (!line.empty() && line[0] != '#')
+        {
+            header = sscanf(line.c_str(), " x = %d , y = %d", &pattern.columns, &pattern.rows) == 2;
+
+            if (!header)
+            {
+                return false;
+            }
+        }
+    }
+
+    if (!header || pattern.rows <= 0 || pattern.columns <= 0 || (int64_t) pattern.rows * pattern.columns > 1 << 26)
+    {
+        return false;
+    }
+
+    pattern.cells.assign((size_t) pattern.rows * pattern.columns, 0);
+
+    int row = 0, column = 0, count = 0;
+    char symbol;
+
+    while (file.get(symbol) && symbol != '!')
+    {
+        if (isdigit((unsigned char) symbol))
+        {
+            count = std::min(count * 10 + (symbol - '0'), 1 << 26);
+            continue;
+        }
+
+        if (isspace((unsigned char) symbol))
+        {
+            continue;
+        }
+
+        int run = count > 0 ? count : 1;
+        count = 0;
+
+        if (symbol == '$')
+        {
+            row += run;
+            column = 0;
+            continue;
+        }
+
+        // "b" is dead, "o" and the states of other rules count as alive.
+        for (int i = 0; i < run; i++, column++)
+        {
+            if (symbol != 'b' && symbol != '.' && row < pattern.rows && column < pattern.columns)
+            {
+                pattern.cells[(size_t) row * pattern.columns + column] = 1;
+            }
+        }
+    }
+
+    return true;
+}
+
+/** @fn LoadPlainText(std::ifstream &file, struct_pattern &pattern)
+ *  @brief Reads a pattern drawn with "." and "O", comments start with "!".
+ */
+static bool LoadPlainText(std::ifstream &file, struct_pattern &pattern)
+{
+    std::vector<std::string> lines;
+    std::string line;
+
+    while (std::getline(file, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+
+        if (line.compare(0, 6, "!Name:") == 0)
+        {
+            pattern.name = line.substr(std::min<size_t>(7, line.size()));
+        }
+        else if (line.empty() || line[0] != '!')
+        {
+            lines.push_back(line);
+        }
+    }
+
+    pattern.rows = lines.size();
+    pattern.columns = 0;
+
+    for (const std::string &text : lines)
+    {
+        pattern.columns = std::max<int>(pattern.columns, text.size());
+    }
+
+    if (pattern.rows == 0 || pattern.columns == 0)
+    {
+        return false;
+    }
+
+    pattern.cells.assign((size_t) pattern.rows * pattern.columns, 0);
+
+    for (int row = 0; row < pattern.rows; row++)
+    {
+        for (int column = 0; column < lines[row].size(); column++)
+        {
+            pattern.cells[(size_t) row * pattern.columns + column] = lines[row][column] == 'O' ||
+                                                                     lines[row][column] == '*';
+        }
+    }
+
+    return true;
+}
+
+/** @fn LoadPattern(std::string path, struct_pattern &pattern)
+ *  @brief Reads a pattern file. Files ending with ".cells" are plain text, all others run length encoded.
+ */
+bool LoadPattern(std::string path, struct_pattern &pattern)
+{
+    std::ifstream file(path);
+
+    if (!file)
+    {
+        return false;
+    }
+
+    pattern.name = path.substr(path.find_last_of('/') + 1);
+    pattern.rows = 0;
+    pattern.columns = 0;
+
+    bool plain_text = path.size() > 6 && path.compare(path.size() - 6, 6, ".cells") == 0;
+
+    return plain_text ? LoadPlainText(file, pattern) : LoadRunLength(file, pattern);
+}
+
+/** @fn CellEditor::CellEditor(std::string pattern_file)
+ *  @brief Constructor of the class CellEditor.
+ *
+ *  Without a usable pattern file, a glider is stamped.
+ */
+CellEditor::CellEditor(std::string pattern_file)
+{
+    this->_painting = false;
+    this->_alive = true;
+    this->_last_row = 0;
+    this->_last_column = 0;
+    this->_mouse_x = 0;
+    this->_mouse_y = 0;
+
+    if (pattern_file != "none" && !LoadPattern(pattern_file, _pattern))
+    {
+        fprintf(stdout,"Cannot read the pattern %s, a glider is used instead.\n", pattern_file.c_str());
+        pattern_file = "none";
+    }
+
+    if (pattern_file == "none")
+    {
+        _pattern = {"glider", 3, 3, {0, 1, 0,
+                                     0, 0, 1,
+                                     1, 1, 1}};
+    }
+
+    fprintf(stdout,"The key S stamps the pattern %s (%i x %i) at the cursor.\n", _pattern.name.c_str(),
+            _pattern.rows, _pattern.columns);
+}
+
+/** @fn CellEditor::~CellEditor()
+ *  @brief Destructor of the class CellEditor.
+ *
+ */
+CellEditor::~CellEditor()
+{
+
+}
+
+/** @fn CellEditor::HandleEvent(const sf::Event &event, const Visual2D &visualization)
+ *  @brief Turns mouse and key events into queued edits.
+ */
+bool CellEditor::HandleEvent(const sf::Event &event, const Visual2D &visualization)
+{
+    int row, column;
+
+    switch(event.type)
+    {
+        case sf::Event::MouseButtonPressed :
+            if (event.mouseButton.button != sf::Mouse::Left && event.mouseButton.button != sf::Mouse::Right)
+            {
+                return false;
+            }
+
+            _alive = event.mouseButton.button == sf::Mouse::Left;
+            _painting = visualization.CellAt(event.mouseButton.x, event.mouseButton.y, row, column);
+
+            if (_painting)
+            {
+                this->PaintLine(row, column, row, column, _alive);
+            }
+
+            return true;
+        case sf::Event::MouseButtonReleased :
+            if (event.mouseButton.button != sf::Mouse::Left && event.mouseButton.button != sf::Mouse::Right)
+            {
+                return false;
+            }
+
+            _painting = false;
+            return true;
+        case sf::Event::MouseMoved :
+            _mouse_x = event.mouseMove.x;
+            _mouse_y = event.mouseMove.y;
+
+            // The camera may also want to see the move, e.g. for dragging with the middle mouse button.
+            if (_painting && visualization.CellAt(_mouse_x, _mouse_y, row, column))
+            {
+                this->PaintLine(_last_row, _last_column, row, column, _alive);
+            }
+
+            return false;
+        case sf::Event::KeyPressed :
+            if (event.key.code == sf::Keyboard::S)
+            {
+                if (visualization.CellAt(_mouse_x, _mouse_y, row, column))
+                {
+                    this->Stamp(row, column);
+                }
+
+                return true;
+            }
+
+            if (event.key.code == sf::Keyboard::R)
+            {
+                this->Rotate();
+                return true;
+            }
+
+            return false;
+        default:
+            return false;
+    }
+}
+
+/** @fn CellEditor::PaintLine(int row0, int column0, int row1, int column1, bool alive)
+ *  @brief Queues all individuals on the line between two cursor positions (Bresenham).
+ */
+void CellEditor::PaintLine(int row0, int column0, int row1, int column1, bool alive)
+{
+    int delta_rows = abs(row1 - row0), delta_columns = abs(column1 - column0);
+    int step_row = row0 < row1 ? 1 : -1, step_column = column0 < column1 ? 1 : -1;
+    int error = delta_columns - delta_rows;
+
+    while (true)
+    {
+        _queue.push_back({row0, column0, alive});
+
+        if (row0 == row1 && column0 == column1)
+        {
+            break;
+        }
+
+        int twice = 2 * error;
+
+        if (twice > -delta_rows)
+        {
+            error -= delta_rows;
+            column0 += step_column;
+        }
+
+        if (twice < delta_columns)
+        {
+            error += delta_columns;
+            row0 += step_row;
+        }
+    }
+
+    _last_row = row1;
+    _last_column = column1;
+}
+
+/** @fn CellEditor::Stamp(int row, int column)
+ *  @brief Queues the whole pattern centered at the given individual. The dead cells of the pattern are cleared.
+ */
+void CellEditor::Stamp(int row, int column)
+{
+    int row0 = row - _pattern.rows / 2, column0 = column - _pattern.columns / 2;
+
+    for (int r = 0; r < _pattern.rows; r++)
+    {
+        for (int c = 0; c < _pattern.columns; c++)
+        {
+            _queue.push_back({row0 + r, column0 + c, _pattern.cells[(size_t) r * _pattern.columns + c] != 0});
+        }
+    }
+}
+
+/** @fn CellEditor::Rotate()
+ *  @brief Turns the pattern clockwise by 90 degrees.
+ */
+void CellEditor::Rotate()
+{
+    std::vector<uint8_t> cells(_pattern.cells.size());
+
+    for (int r = 0; r < _pattern.rows; r++)
+    {
+        for (int c = 0; c < _pattern.columns; c++)
+        {
+            cells[(size_t) c * _pattern.rows + (_pattern.rows - 1 - r)] =
+                _pattern.cells[(size_t) r * _pattern.columns + c];
+        }
+    }
+
+    std::swap(_pattern.rows, _pattern.columns);
+    _pattern.cells.swap(cells);
+}
+
+/** @fn CellEditor::Apply(LifeCycle &lifecycle)
+ *  @brief Applies all queued edits as one batch. Called between two generations.
+ */
+void CellEditor::Apply(LifeCycle &lifecycle)
+{
+    if (_queue.empty())
+    {
+        return;
+    }
+
+    lifecycle.SetCells(_queue);
+    _queue.clear();
+}
+
+std::vector<struct_cell_change> CellEditor::TakeEdits()
+{
+    std::vector<struct_cell_change> edits;
+    edits.swap(_queue);
+
+    return edits;
+}
+
+}
@@ -0,0 +1,913 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    census.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Census of the objects in the biotope: still lifes, oscillators and spaceships.
+ *
+ * This program part labels the clusters of living individuals, brings them into a canonical form, counts and
+ * classifies them and writes the result into a CSV file.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <errno.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+
+#include "census.hpp"
+#include "lifeCycle.hpp"
+#include "lifeRule.hpp"
+#include "workerPool.hpp"
+
+
+namespace GameOfLife
+{
+    // Known objects in plain text, rows separated by "/".
+    static const std::vector<std::pair<std::string, std::string>> known_objects =
+    {
+        {"block", "OO/OO"},
+        {"beehive", ".OO./O..O/.OO."},
+        {"loaf", ".OO./O..O/.O.O/..O."},
+        {"boat", "OO./O.O/.O."},
+        {"ship", "OO./O.O/.OO"},
+        {"tub", ".O./O.O/.O."},
+        {"pond", ".OO./O..O/O..O/.OO."},
+        {"long_boat", "OO../O.O./.O.O/..O."},
+        {"barge", ".O../O.O./.O.O/..O."},
+        {"blinker", "OOO"},
+        {"toad", ".OOO/OOO."},
+        {"beacon", "OO../OO../..OO/..OO"},
+        {"pentadecathlon", "..O....O../OO.OOOO.OO/..O....O.."},
+        {"glider", ".O./..O/OOO"},
+        {"lwss", ".O..O/O..../O...O/OOOO."}
+    };
+
+/** @fn Parallel(WorkerPool *pool, int count, int grain, std::function<void(int, int, int)> function)
+ *  @brief Runs the function over [0, count) with the pool, or in the calling thread without one.
+ */
+static void Parallel(WorkerPool *pool, int count, int grain, std::function<void(int, int, int)> function)
+{
+    if (pool && pool->Size() > 1)
+    {
+        pool->ParallelFor(count, grain, function);
+    }
+    else if (count > 0)
+    {
+        function(0, count, 0);
+    }
+}
+
+static uint64_t Mix(uint64_t x)
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+static uint64_t RunMask(int length)
+{
+    return length >= 64 ? ~0ULL : (1ULL << length) - 1;
+}
+
+/** @fn Transform(const struct_shape &shape, int symmetry, struct_shape &result)
+ *  @brief One of the 8 symmetric forms: bit 0 transposes, bit 1 flips the rows, bit 2 flips the columns.
+ */
+template<class Shape>
+static void Transform(const Shape &shape, int symmetry, Shape &result)
+{
+    bool transpose = symmetry & 1;
+
+    result.height = transpose ? shape.width : shape.height;
+    result.width = transpose ? shape.height : shape.width;
+    result.rows.assign(result.height, 0);
+
+    for (int r = 0; r < shape.height; r++)
+    {
+        for (uint64_t bits = shape.rows[r]; bits != 0; bits &= bits - 1)
+        {
+            int c = __builtin_ctzll(bits);
+            int row = transpose ? c : r, column = transpose ? r : c;
+
+            if (symmetry & 2) row = result.height - 1 - row;
+            if (symmetry & 4) column = result.width - 1 - column;
+
+            result.rows[row] |= 1ULL << column;
+        }
+    }
+}
+
+template<class Shape>
+static bool Less(const Shape &a, const Shape &b)
+{
+    if (a.height != b.height) return a.height < b.height;
+    if (a.width != b.width) return a.width < b.width;
+
+    return a.rows < b.rows;
+}
+
+template<class Shape>
+static bool Same(const Shape &a, const Shape &b)
+{
+    return a.height == b.height && a.width == b.width && a.rows == b.rows;
+}
+
+/** @fn Canonical(const struct_shape &shape, struct_shape &best, struct_shape &candidate)
+ *  @brief Smallest of the 8 symmetric forms into "best", returns its hash (never 0).
+ */
+template<class Shape>
+static uint64_t Canonical(const Shape &shape, Shape &best, Shape &candidate)
+{
+    Transform(shape, 0, best);
+
+    for (int symmetry = 1; symmetry < 8; symmetry++)
+    {
+        Transform(shape, symmetry, candidate);
+
+        if (Less(candidate, best))
+        {
+            std::swap(candidate, best);
+        }
+    }
+
+    uint64_t hash = Mix((uint64_t) best.height << 32 | best.width);
+
+    for (uint64_t row : best.rows)
+    {
+        hash = Mix(hash ^ row);
+    }
+
+    return hash != 0 ? hash : 1;
+}
+
+/** @fn NextPhase(uint64_t grid[64], int &top, int &bottom, int &left, struct_shape &phase)
+ *  @brief Next generation of a 64 x 64 grid, of which only the rows [top, bottom] are alive.
+ *
+ *  The individuals outside of the grid are dead. Returns false, if the grid dies out or reaches its border. Otherwise
+ *  the new rows and the normalized shape with its left column are returned.
+ */
+template<class Shape>
+static bool NextPhase(uint64_t grid[tile_size], int &top, int &bottom, int &left, Shape &phase)
+{
+    uint64_t next[tile_size];
+    int first = top - 1, last = bottom + 1;
+
+    for (int row = first; row <= last; row++)
+    {
+        uint64_t above = grid[row - 1], middle = grid[row], below = grid[row + 1];
+
+        uint64_t neighbours[8] = {above << 1, above, above >> 1, middle << 1, middle >> 1,
+                                  below << 1, below, below >> 1};
+        uint64_t ones = 0, twos = 0, fours = 0, eights = 0;
+
+        for (int n = 0; n < 8; n++)
+        {
+            uint64_t carry_one = ones & neighbours[n];
+            ones ^= neighbours[n];
+
+            uint64_t carry_two = twos & carry_one;
+            twos ^= carry_one;
+
+            eights |= fours & carry_two;
+            fours ^= carry_two;
+        }
+
+        next[row] = ApplyRule<ConwayRule>(middle, ones, twos, fours, eights);
+    }
+
+    memcpy(&grid[first], &next[first], (last - first + 1) * sizeof(uint64_t));
+
+    for (top = first; top <= last && grid[top] == 0; top++);
+
+    if (top > last)
+    {
+        return false;
+    }
+
+    for (bottom = last; grid[bottom] == 0; bottom--);
+
+    uint64_t columns = 0;
+
+    for (int row = top; row <= bottom; row++)
+    {
+        columns |= grid[row];
+    }
+
+    // The grid keeps one dead row and column all around, so that the next generation needs no bounds checks.
+    if (top == 1 || bottom == tile_size - 2 || (columns & (1ULL | 1ULL << (tile_size - 1))) != 0)
+    {
+        return false;
+    }
+
+    left = __builtin_ctzll(columns);
+
+    phase.height = bottom - top + 1;
+    phase.width = tile_size - __builtin_clzll(columns) - left;
+    phase.rows.assign(phase.height, 0);
+
+    for (int row = top; row <= bottom; row++)
+    {
+        phase.rows[row - top] = grid[row] >> left;
+    }
+
+    return true;
+}
+
+/** @fn ObjectCensus::ObjectCensus(bool verbose)
+ *  @brief Constructor of the class ObjectCensus.
+ *
+ *  The known objects are classified once, so that their canonical keys are known.
+ */
+ObjectCensus::ObjectCensus(bool verbose)
+{
+    this->_verbose = verbose;
+    this->_file = nullptr;
+    this->_parent_capacity = 0;
+    this->_slot_capacity = 0;
+    this->_oversized = 0;
+    this->_oversized_cells = 0;
+    this->_objects = 0;
+    this->_generation = 0;
+
+    for (const std::pair<std::string, std::string> &known : known_objects)
+    {
+        struct_census_shape shape = {0, 0, {0}};
+
+        for (char symbol : known.second)
+        {
+            if (symbol == '/')
+            {
+                shape.rows.push_back(0);
+                shape.width = 0;
+                continue;
+            }
+
+            shape.rows.back() |= (uint64_t) (symbol == 'O') << shape.width++;
+        }
+
+        shape.height = shape.rows.size();
+        _names[this->Classify(shape).key] = known.first;
+    }
+}
+
+/** @fn ObjectCensus::~ObjectCensus()
+ *  @brief Destructor of the class ObjectCensus.
+ *
+ */
+ObjectCensus::~ObjectCensus()
+{
+    if (_file != nullptr)
+    {
+        fclose(_file);
+    }
+}
+
+/** @fn ObjectCensus::OpenFile(std::string path)
+ *  @brief Opens the CSV file, every census appends its kinds of objects.
+ */
+void ObjectCensus::OpenFile(std::string path)
+{
+    if (_file != nullptr)
+    {
+        fclose(_file);
+    }
+
+    _file = fopen(path.c_str(), "w");
+
+    if (_file == nullptr)
+    {
+        fprintf(stdout,"Cannot open the census file %s: %s\n", path.c_str(), strerror(errno));
+        return;
+    }
+
+    fprintf(_file, "generation,object,kind,period,cells,count\n");
+}
+
+/** @fn ObjectCensus::Take(const LifeCycle &lifecycle, WorkerPool *pool)
+ *  @brief Counts the objects of the current generation.
+ */
+void ObjectCensus::Take(const LifeCycle &lifecycle, WorkerPool *pool)
+{
+    auto start = std::chrono::steady_clock::now();
+    int workers = pool ? pool->Size() : 1;
+
+    // 1. Runs of each band.
+    _bands.resize(lifecycle.tiles_y);
+
+    Parallel(pool, lifecycle.tiles_y, 1, [this, &lifecycle](int begin, int end, int worker)
+    {
+        for (int band = begin; band < end; band++)
+        {
+            this->ExtractRuns(lifecycle, band);
+        }
+    });
+
+    size_t runs = 0;
+
+    for (struct_census_band &band : _bands)
+    {
+        band.offset = runs;
+        runs += band.runs.size();
+    }
+
+    if (runs > _parent_capacity)
+    {
+        _parent.reset(new std::atomic<uint32_t>[runs]);
+        _parent_capacity = runs;
+    }
+
+    // 2. Union-find over the runs. Every run starts as its own object.
+    Parallel(pool, _bands.size(), 1, [this](int begin, int end, int worker)
+    {
+        for (int band = begin; band < end; band++)
+        {
+            for (uint32_t run = _bands[band].offset; run < _bands[band].offset + _bands[band].runs.size(); run++)
+            {
+                _parent[run].store(run, std::memory_order_relaxed);
+            }
+        }
+    });
+
+    Parallel(pool, _bands.size(), 1, [this](int begin, int end, int worker)
+    {
+        for (int band = begin; band < end; band++)
+        {
+            this->JoinRuns(band);
+        }
+    });
+
+    // The root of an object is its first run, so all runs of an object follow its root. This numbers the objects in
+    // one pass.
+    _object_of_run.resize(runs);
+
+    Parallel(pool, runs, 4096, [this](int begin, int end, int worker)
+    {
+        for (int run = begin; run < end; run++)
+        {
+            _object_of_run[run] = this->Find(run);
+        }
+    });
+
+    uint32_t objects = 0;
+
+    for (uint32_t run = 0; run < runs; run++)
+    {
+        _object_of_run[run] = _object_of_run[run] == run ? objects++ : _object_of_run[_object_of_run[run]];
+    }
+
+    // Runs sorted by object (counting sort), within an object row by row.
+    _object_start.assign(objects + 1, 0);
+
+    for (uint32_t run = 0; run < runs; run++)
+    {
+        _object_start[_object_of_run[run] + 1]++;
+    }
+
+    for (uint32_t object = 0; object < objects; object++)
+    {
+        _object_start[object + 1] += _object_start[object];
+    }
+
+    _object_runs.resize(runs);
+
+    for (const struct_census_band &band : _bands)
+    {
+        for (size_t i = 0; i < band.runs.size(); i++)
+        {
+            _object_runs[_object_start[_object_of_run[band.offset + i]]++] = band.runs[i];
+        }
+    }
+
+    for (uint32_t object = objects; object > 0; object--)
+    {
+        _object_start[object] = _object_start[object - 1];
+    }
+
+    _object_start[0] = 0;
+
+    // 3. Canonical forms into the hash table, which has always at least half of its slots free.
+    size_t capacity = 1024;
+
+    while (capacity < 2 * (size_t) objects)
+    {
+        capacity *= 2;
+    }
+
+    if (capacity > _slot_capacity)
+    {
+        _slots.reset(new struct_census_slot[capacity]);
+        _slot_shapes.resize(capacity);
+        _slot_capacity = capacity;
+    }
+
+    for (size_t slot = 0; slot < _slot_capacity; slot++)
+    {
+        _slots[slot].key.store(0, std::memory_order_relaxed);
+        _slots[slot].count.store(0, std::memory_order_relaxed);
+    }
+
+    _oversized = 0;
+    _oversized_cells = 0;
+    _scratch.resize(3 * workers);
+
+    Parallel(pool, objects, 256, [this](int begin, int end, int worker)
+    {
+        for (int object = begin; object < end; object++)
+        {
+            this->CountObject(object, worker);
+        }
+    });
+
+    // 4. Every distinct form runs on its own. The forms need very different times, so they are stolen one by one.
+    std::vector<size_t> forms;
+
+    for (size_t slot = 0; slot < _slot_capacity; slot++)
+    {
+        if (_slots[slot].key.load(std::memory_order_relaxed) != 0)
+        {
+            forms.push_back(slot);
+        }
+    }
+
+    // The classes of earlier censuses are kept. A chaotic biotope produces new forms without end, so the memory of
+    // the classes is limited.
+    if (_classes.size() > max_classes)
+    {
+        _classes.clear();
+    }
+
+    std::vector<size_t> unknown;
+
+    for (size_t form = 0; form < forms.size(); form++)
+    {
+        if (_classes.find(_slots[forms[form]].key.load(std::memory_order_relaxed)) == _classes.end())
+        {
+            unknown.push_back(forms[form]);
+        }
+    }
+
+    std::vector<struct_census_class> classes(unknown.size());
+
+    auto classify = [this, &unknown, &classes](int form, int worker)
+    {
+        classes[form] = this->Classify(_slot_shapes[unknown[form]]);
+    };
+
+    if (pool && pool->Size() > 1)
+    {
+        pool->RunTasks(unknown.size(), classify);
+    }
+    else
+    {
+        for (int form = 0; form < unknown.size(); form++)
+        {
+            classify(form, 0);
+        }
+    }
+
+    for (size_t form = 0; form < unknown.size(); form++)
+    {
+        _classes[_slots[unknown[form]].key.load(std::memory_order_relaxed)] = classes[form];
+    }
+
+    // The phases of an oscillator or spaceship share the key of the object.
+    std::unordered_map<uint64_t, size_t> entry_of_key;
+    _entries.clear();
+
+    for (size_t form = 0; form < forms.size(); form++)
+    {
+        const struct_census_class &form_class = _classes[_slots[forms[form]].key.load(std::memory_order_relaxed)];
+        uint64_t count = _slots[forms[form]].count.load(std::memory_order_relaxed);
+        auto it = entry_of_key.find(form_class.key);
+
+        if (it != entry_of_key.end())
+        {
+            _entries[it->second].count += count;
+            continue;
+        }
+
+        entry_of_key[form_class.key] = _entries.size();
+        _entries.push_back({this->Name(form_class), form_class.kind, form_class.period, form_class.cells,
+                            form_class.key, count});
+    }
+
+    if (_oversized > 0)
+    {
+        _entries.push_back({"oversized", "oversized", 0, (int) (_oversized_cells / _oversized), 0, _oversized});
+    }
+
+    std::sort(_entries.begin(), _entries.end(), [](const struct_census_entry &a, const struct_census_entry &b)
+    {
+        return a.count != b.count ? a.count > b.count : a.name < b.name;
+    });
+
+    _objects = objects;
+    _generation = lifecycle.Generation();
+
+    if (_verbose)
+    {
+        std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+
+        fprintf(stdout,"\nCensus of generation %lu: %lu objects of %lu kinds (%.1f ms).\n", (unsigned long) _generation,
+                (unsigned long) _objects, (unsigned long) _entries.size(), duration.count());
+    }
+}
+
+/** @fn ObjectCensus::ExtractRuns(const LifeCycle &lifecycle, int band)
+ *  @brief Collects the runs of living individuals of one tile row. A run can go on over several tiles.
+ */
+void ObjectCensus::ExtractRuns(const LifeCycle &lifecycle, int band)
+{
+    struct_census_band &runs = _bands[band];
+    int rows = std::min(tile_size, lifecycle.Rows() - band * tile_size);
+
+    runs.runs.clear();
+    runs.run_start.assign(tile_size + 1, 0);
+
+    // Rows of the tiles of the band. A cold tile is decoded only once.
+    std::vector<uint64_t> buffer((size_t) lifecycle.tiles_x * tile_size);
+    std::vector<const uint64_t *> tile_rows(lifecycle.tiles_x);
+
+    for (int w = 0; w < lifecycle.tiles_x; w++)
+    {
+        tile_rows[w] = lifecycle.TileRows(lifecycle.TileSlot(band, w), &buffer[(size_t) w * tile_size]);
+    }
+
+    for (int r = 0; r < tile_size; r++)
+    {
+        runs.run_start[r] = runs.runs.size();
+
+        if (r >= rows)
+        {
+            continue;
+        }
+
+        for (int w = 0; w < lifecycle.tiles_x; w++)
+        {
+            uint64_t bits = tile_rows[w][r];
+
+            while (bits != 0)
+            {
+                int begin = __builtin_ctzll(bits);
+                uint64_t rest = ~(bits >> begin);
+                int length = rest != 0 ? __builtin_ctzll(rest) : tile_size;
+                int column = w * tile_size + begin;
+
+                if (runs.runs.size() > runs.run_start[r] && runs.runs.back().end == column)
+                {
+                    runs.runs.back().end += length;
+                }
+                else
+                {
+                    runs.runs.push_back({band * tile_size + r, column, column + length});
+                }
+
+                bits = begin + length >= tile_size ? 0 : bits & (~0ULL << (begin + length));
+            }
+        }
+    }
+
+    runs.run_start[tile_size] = runs.runs.size();
+}
+
+/** @fn ObjectCensus::JoinRuns(int band)
+ *  @brief Joins the close runs of a band with each other and with the last two rows of the band above.
+ */
+void ObjectCensus::JoinRuns(int band)
+{
+    const struct_census_band &below = _bands[band];
+
+    for (int r = 0; r < tile_size; r++)
+    {
+        int start = below.run_start[r], count = below.run_start[r + 1] - start;
+
+        // Runs of the same row with one dead individual in between.
+        for (int i = start + 1; i < start + count; i++)
+        {
+            if (below.runs[i].begin <= below.runs[i - 1].end + 1)
+            {
+                this->Union(below.offset + i - 1, below.offset + i);
+            }
+        }
+
+        for (int distance = 1; distance <= 2; distance++)
+        {
+            if (r < distance && band == 0)
+            {
+                continue;
+            }
+
+            const struct_census_band &above = r >= distance ? below : _bands[band - 1];
+            int above_row = r >= distance ? r - distance : r - distance + tile_size;
+            int above_start = above.run_start[above_row];
+
+            this->JoinRows(above.runs.data() + above_start, above.run_start[above_row + 1] - above_start,
+                           above.offset + above_start, below.runs.data() + start, count, below.offset + start);
+        }
+    }
+}
+
+/** @fn ObjectCensus::JoinRows(...)
+ *  @brief Joins the runs of two rows, which are at most two individuals apart, also diagonally.
+ */
+void ObjectCensus::JoinRows(const struct_census_run *above, int above_count, uint32_t above_offset,
+                            const struct_census_run *below, int below_count, uint32_t below_offset)
+{
+    int first = 0;
+
+    for (int i = 0; i < above_count; i++)
+    {
+        // The runs are sorted, a run of the lower row left of this run is also left of all further runs.
+        while (first < below_count && below[first].end + 1 < above[i].begin)
+        {
+            first++;
+        }
+
+        for (int j = first; j < below_count && below[j].begin <= above[i].end + 1; j++)
+        {
+            this->Union(above_offset + i, below_offset + j);
+        }
+    }
+}
+
+/** @fn ObjectCensus::Find(uint32_t run)
+ *  @brief Root of the object of a run. Halves the path on the way.
+ */
+uint32_t ObjectCensus::Find(uint32_t run)
+{
+    while (true)
+    {
+        uint32_t parent = _parent[run].load(std::memory_order_relaxed);
+
+        if (parent == run)
+        {
+            return run;
+        }
+
+        uint32_t grand = _parent[parent].load(std::memory_order_relaxed);
+
+        // Another thread may have changed the parent already, then the halving is left out.
+        if (grand != parent)
+        {
+            _parent[run].compare_exchange_weak(parent, grand, std::memory_order_relaxed);
+        }
+
+        run = grand;
+    }
+}
+
+/** @fn ObjectCensus::Union(uint32_t a, uint32_t b)
+ *  @brief Joins the objects of two runs. The larger root is hung below the smaller one.
+ *
+ *  Only a root can get a new parent and only with compare and swap, so two threads cannot lose a union. Since the
+ *  smaller root always wins, the root of an object is its first run.
+ */
+void ObjectCensus::Union(uint32_t a, uint32_t b)
+{
+    while (true)
+    {
+        a = this->Find(a);
+        b = this->Find(b);
+
+        if (a == b)
+        {
+            return;
+        }
+
+        if (a < b)
+        {
+            std::swap(a, b);
+        }
+
+        uint32_t expected = a;
+
+        if (_parent[a].compare_exchange_strong(expected, b, std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+}
+
+/** @fn ObjectCensus::CountObject(int object, int worker)
+ *  @brief Cuts an object out of its runs and counts its canonical form.
+ */
+void ObjectCensus::CountObject(int object, int worker)
+{
+    const struct_census_run *runs = &_object_runs[_object_start[object]];
+    int count = _object_start[object + 1] - _object_start[object];
+    int left = runs[0].begin, right = runs[0].end, cells = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        left = std::min(left, runs[i].begin);
+        right = std::max(right, runs[i].end);
+        cells += runs[i].end - runs[i].begin;
+    }
+
+    int height = runs[count - 1].row - runs[0].row + 1;
+
+    if (height > tile_size || right - left > tile_size)
+    {
+        _oversized.fetch_add(1, std::memory_order_relaxed);
+        _oversized_cells.fetch_add(cells, std::memory_order_relaxed);
+        return;
+    }
+
+    struct_census_shape &shape = _scratch[3 * worker];
+
+    shape.height = height;
+    shape.width = right - left;
+    shape.rows.assign(height, 0);
+
+    for (int i = 0; i < count; i++)
+    {
+        shape.rows[runs[i].row - runs[0].row] |= RunMask(runs[i].end - runs[i].begin) << (runs[i].begin - left);
+    }
+
+    struct_census_shape &best = _scratch[3 * worker + 1];
+    uint64_t key = Canonical(shape, best, _scratch[3 * worker + 2]);
+
+    this->Insert(key, best);
+}
+
+/** @fn ObjectCensus::Insert(uint64_t key, const struct_census_shape &shape)
+ *  @brief Counts a canonical form. The thread, which claims an empty slot, stores the form.
+ */
+void ObjectCensus::Insert(uint64_t key, const struct_census_shape &shape)
+{
+    size_t mask = _slot_capacity - 1;
+
+    for (size_t slot = key & mask; ; slot = (slot + 1) & mask)
+    {
+        uint64_t current = _slots[slot].key.load(std::memory_order_acquire);
+
+        if (current == 0)
+        {
+            if (_slots[slot].key.compare_exchange_strong(current, key, std::memory_order_acq_rel))
+            {
+                _slot_shapes[slot] = shape;
+            }
+        }
+
+        if (current == 0 || current == key)
+        {
+            _slots[slot].count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+/** @fn ObjectCensus::Classify(const struct_census_shape &shape)
+ *  @brief Runs a form on its own, until it comes back or at most max_period generations.
+ *
+ *  The form starts in the middle of a 64 x 64 grid. It comes back, if a later generation has the same shape in the
+ *  same orientation, moved for a spaceship.
+ */
+ObjectCensus::struct_census_class ObjectCensus::Classify(const struct_census_shape &shape) const
+{
+    struct_census_shape best, candidate;
+    struct_census_class result = {"other", 0, 0, Canonical(shape, best, candidate)};
+
+    for (uint64_t row : shape.rows)
+    {
+        result.cells += __builtin_popcountll(row);
+    }
+
+    if (shape.height > classify_size || shape.width > classify_size)
+    {
+        return result;
+    }
+
+    const int margin = (tile_size - classify_size) / 2;
+    uint64_t grid[tile_size];
+    int top, bottom, left;
+    struct_census_shape phase;
+
+    auto start = [&]()
+    {
+        memset(grid, 0, sizeof grid);
+
+        for (int r = 0; r < shape.height; r++)
+        {
+            grid[margin + r] = shape.rows[r] << margin;
+        }
+
+        top = margin;
+        bottom = margin + shape.height - 1;
+    };
+
+    start();
+
+    for (int generation = 1; generation <= max_period; generation++)
+    {
+        if (!NextPhase(grid, top, bottom, left, phase))
+        {
+            return result;
+        }
+
+        if (Same(phase, shape))
+        {
+            bool moved = top != margin || left != margin;
+
+            result.kind = moved ? "spaceship" : generation == 1 ? "still_life" : "oscillator";
+            result.period = generation;
+            break;
+        }
+    }
+
+    if (result.period == 0)
+    {
+        return result;
+    }
+
+    // Only the objects, which come back, need the keys of all their phases. The phase with the smallest key stands
+    // for the whole object.
+    start();
+
+    for (int generation = 1; generation < result.period; generation++)
+    {
+        NextPhase(grid, top, bottom, left, phase);
+
+        uint64_t key = Canonical(phase, best, candidate);
+
+        if (key < result.key)
+        {
+            result.key = key;
+            result.cells = 0;
+
+            for (uint64_t row : phase.rows)
+            {
+                result.cells += __builtin_popcountll(row);
+            }
+        }
+    }
+
+    return result;
+}
+
+/** @fn ObjectCensus::Name(const struct_census_class &object)
+ *  @brief Usual name of a known object, otherwise a name after the prefixes of apgsearch.
+ */
+std::string ObjectCensus::Name(const struct_census_class &object) const
+{
+    auto it = _names.find(object.key);
+
+    if (it != _names.end())
+    {
+        return it->second;
+    }
+
+    static std::unordered_map<std::string, std::string> const prefixes =
+        { {"still_life", "xs"},
+        {"oscillator", "xp"},
+        {"spaceship", "xq"},
+        {"other", "other"} };
+
+    char hash[16];
+    snprintf(hash, sizeof hash, "%08x", (unsigned) (object.key >> 32));
+
+    int number = object.kind == "still_life" || object.kind == "other" ? object.cells : object.period;
+
+    return prefixes.at(object.kind) + std::to_string(number) + "_" + hash;
+}
+
+/** @fn ObjectCensus::Write()
+ *  @brief Appends the kinds of the last census to the CSV file.
+ */
+void ObjectCensus::Write()
+{
+    if (_file == nullptr)
+    {
+        return;
+    }
+
+    for (const struct_census_entry &entry : _entries)
+    {
+        fprintf(_file, "%lu,%s,%s,%i,%i,%lu\n", (unsigned long) _generation, entry.name.c_str(), entry.kind.c_str(),
+                entry.period, entry.cells, (unsigned long) entry.count);
+    }
+
+    fflush(_file);
+}
+
+/** @fn ObjectCensus::Report(int lines)
+ *  @brief Prints the most frequent kinds of objects.
+ */
+void ObjectCensus::Report(int lines) const
+{
+    for (int i = 0; i < lines && i < _entries.size(); i++)
+    {
+        fprintf(stdout,"%12lu  %s (%s, %i individuals)\n", (unsigned long) _entries[i].count,
+                _entries[i].name.c_str(), _entries[i].kind.c_str(), _entries[i].cells);
+    }
+}
+
+}
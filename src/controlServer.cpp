@@ -0,0 +1,765 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    controlServer.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Remote control of the life cycle over a local socket.
+ *
+ * This program part accepts the connections, decodes the commands and streams the changes of the biotope to the
+ * subscribers.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <errno.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "controlServer.hpp"
+#include "deltaCodec.hpp"
+#include "lifeCycle.hpp"
+#include "profiler.hpp"
+
+
+namespace GameOfLife
+{
+    // Larger messages are treated as protocol error.
+    static constexpr uint32_t max_payload = 64u << 20;
+
+    // A client with more unsent bytes is disconnected.
+    static constexpr size_t max_output = 256u << 20;
+
+    // Time per call of Poll() for commanded steps, so that the window stays responsive.
+    static constexpr std::chrono::milliseconds step_budget(40);
+
+static void Append(std::vector<uint8_t> &buffer, const void *data, size_t length)
+{
+    buffer.insert(buffer.end(), (const uint8_t *) data, (const uint8_t *) data + length);
+}
+
+/** @fn ControlServer::ControlServer(std::string address, bool paused)
+ *  @brief Constructor of the class ControlServer.
+ *
+ *  The address is "unix:<path>" or "tcp:<port>". TCP listens only on the loopback interface.
+ */
+ControlServer::ControlServer(std::string address, bool paused)
+{
+    this->_listen = -1;
+    this->_epoll = -1;
+    this->_paused = paused;
+    this->_sent_stamp = 0;
+    this->_sent_generation = 0;
+    this->_subscribers = 0;
+
+    if (address.compare(0, 5, "unix:") == 0)
+    {
+        struct sockaddr_un socket_address = {};
+        socket_address.sun_family = AF_UNIX;
+
+        if (address.size() - 5 >= sizeof socket_address.sun_path)
+        {
+            fprintf(stdout,"The socket path %s is too long. The control server is not started.\n", address.c_str());
+            return;
+        }
+
+        strcpy(socket_address.sun_path, address.c_str() + 5);
+
+        _listen = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+        // A socket file of an earlier run would block the bind.
+        unlink(socket_address.sun_path);
+
+        if (_listen >= 0 && bind(_listen, (struct sockaddr *) &socket_address, sizeof socket_address) == 0)
+        {
+            _unix_path = socket_address.sun_path;
+        }
+        else if (_listen >= 0)
+        {
+            close(_listen);
+            _listen = -1;
+        }
+    }
+    else if (address.compare(0, 4, "tcp:") == 0)
+    {
+        struct sockaddr_in socket_address = {};
+        socket_address.sin_family = AF_INET;
+        socket_address.sin_port = htons((uint16_t) atoi(address.c_str() + 4));
+        socket_address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        _listen = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+        int reuse = 1;
+
+        if (_listen >= 0 && (setsockopt(_listen, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof reuse) != 0 ||
+                             bind(_listen, (struct sockaddr *) &socket_address, sizeof socket_address) != 0))
+        {
+            close(_listen);
+            _listen = -1;
+        }
+    }
+    else
+    {
+        fprintf(stdout,"Cannot use the control address: %s. The control server is not started.\n", address.c_str());
+        return;
+    }
+
+    if (_listen < 0 || listen(_listen, 16) != 0)
+    {
+        fprintf(stdout,"Cannot listen on %s: %s. The control server is not started.\n", address.c_str(),
+                strerror(errno));
+
+        if (_listen >= 0) close(_listen);
+        _listen = -1;
+        return;
+    }
+
+    _epoll = epoll_create1(EPOLL_CLOEXEC);
+
+    struct epoll_event event = {};
+    event.events = EPOLLIN;
+    event.data.fd = _listen;
+
+    if (_epoll < 0 || epoll_ctl(_epoll, EPOLL_CTL_ADD, _listen, &event) != 0)
+    {
+        fprintf(stdout,"Cannot create the epoll instance: %s. The control server is not started.\n", strerror(errno));
+
+        if (_epoll >= 0) close(_epoll);
+        close(_listen);
+        _epoll = -1;
+        _listen = -1;
+        return;
+    }
+
+    fprintf(stdout,"The control server listens on %s (%s).\n", address.c_str(), _paused ? "paused" : "running");
+}
+
+/** @fn ControlServer::~ControlServer()
+ *  @brief Destructor of the class ControlServer.
+ *
+ *  This functions closes all connections and removes the socket file.
+ */
+ControlServer::~ControlServer()
+{
+    for (auto &client : _clients)
+    {
+        close(client.first);
+    }
+
+    if (_epoll >= 0) close(_epoll);
+    if (_listen >= 0) close(_listen);
+
+    if (!_unix_path.empty())
+    {
+        unlink(_unix_path.c_str());
+    }
+}
+
+/** @fn ControlServer::Poll(LifeCycle &lifecycle)
+ *  @brief Handles all waiting connections and commands without blocking.
+ */
+void ControlServer::Poll(LifeCycle &lifecycle)
+{
+    if (!this->IsOpen())
+    {
+        return;
+    }
+
+    GOL_PROFILE_SCOPE("ControlServer::Poll");
+
+    struct epoll_event events[64];
+    int count;
+
+    do
+    {
+        count = epoll_wait(_epoll, events, 64, 0);
+
+        for (int i = 0; i < count; i++)
+        {
+            int socket = events[i].data.fd;
+
+            if (socket == _listen)
+            {
+                this->Accept();
+                continue;
+            }
+
+            // The client can be gone already because of an earlier event.
+            auto it = _clients.find(socket);
+
+            if (it == _clients.end())
+            {
+                continue;
+            }
+
+            if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR))
+            {
+                this->Receive(it->second, lifecycle);
+            }
+
+            it = _clients.find(socket);
+
+            if (it != _clients.end() && (events[i].events & EPOLLOUT))
+            {
+                this->Flush(it->second);
+            }
+        }
+    }
+    while (count == 64);
+
+    this->RunStepJobs(lifecycle);
+
+    // Edits without a new generation.
+    this->Broadcast(lifecycle);
+}
+
+void ControlServer::Accept()
+{
+    while (true)
+    {
+        int socket = accept4(_listen, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+        if (socket < 0)
+        {
+            return;
+        }
+
+        struct epoll_event event = {};
+        event.events = EPOLLIN;
+        event.data.fd = socket;
+
+        if (epoll_ctl(_epoll, EPOLL_CTL_ADD, socket, &event) != 0)
+        {
+            close(socket);
+            continue;
+        }
+
+        struct_client &client = _clients[socket];
+        client.socket = socket;
+        client.output_offset = 0;
+        client.subscribed = false;
+        client.writing = false;
+    }
+}
+
+/** @fn ControlServer::Receive(struct_client &client, LifeCycle &lifecycle)
+ *  @brief Reads everything the client sent and executes the complete messages.
+ */
+void ControlServer::Receive(struct_client &client, LifeCycle &lifecycle)
+{
+    uint8_t buffer[65536];
+    bool closed = false;
+
+    while (true)
+    {
+        ssize_t received = recv(client.socket, buffer, sizeof buffer, 0);
+
+        if (received > 0)
+        {
+            Append(client.input, buffer, received);
+        }
+        else
+        {
+            closed = received == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR);
+            break;
+        }
+    }
+
+    size_t position = 0;
+
+    while (client.input.size() - position >= sizeof(struct_control_header))
+    {
+        struct_control_header header;
+        memcpy(&header, &client.input[position], sizeof header);
+
+        if (header.length > max_payload)
+        {
+            fprintf(stdout,"\nThe control client %i sent a message of %u bytes and is disconnected.\n",
+                    client.socket, header.length);
+            closed = true;
+            break;
+        }
+
+        if (client.input.size() - position - sizeof header < header.length)
+        {
+            break;
+        }
+
+        this->Execute(client, header.type, &client.input[position + sizeof header], header.length, lifecycle);
+        position += sizeof header + header.length;
+    }
+
+    client.input.erase(client.input.begin(), client.input.begin() + position);
+
+    if (closed)
+    {
+        this->Disconnect(client.socket);
+    }
+}
+
+/** @fn ControlServer::Execute(struct_client &client, uint8_t type, const uint8_t *payload, uint32_t length,
+ *                             LifeCycle &lifecycle)
+ *  @brief Executes one command.
+ */
+void ControlServer::Execute(struct_client &client, uint8_t type, const uint8_t *payload, uint32_t length,
+                            LifeCycle &lifecycle)
+{
+    switch(type)
+    {
+        case control_pause :
+            _paused = true;
+            this->SendStatus(client, lifecycle);
+            break;
+        case control_resume :
+            _paused = false;
+            this->SendStatus(client, lifecycle);
+            break;
+        case control_step :
+        {
+            uint32_t generations = 0;
+
+            if (length >= sizeof generations)
+            {
+                memcpy(&generations, payload, sizeof generations);
+            }
+
+            // The status is sent, when the last generation is done.
+            _paused = true;
+            _step_jobs.push_back({client.socket, generations});
+            break;
+        }
+        case control_set_cells :
+        {
+            uint32_t count = 0;
+
+            if (length >= sizeof count)
+            {
+                memcpy(&count, payload, sizeof count);
+            }
+
+            if (length != sizeof count + (uint64_t) count * sizeof(struct_cell_edit))
+            {
+                static const char error[] = "set_cells: the length does not match the number of cells";
+                this->Send(client, reply_error, error, sizeof error - 1);
+                break;
+            }
+
+            _changes.resize(count);
+
+            for (uint32_t i = 0; i < count; i++)
+            {
+                struct_cell_edit edit;
+                memcpy(&edit, payload + sizeof count + i * sizeof edit, sizeof edit);
+
+                _changes[i] = {edit.row, edit.column, edit.alive != 0};
+            }
+
+            lifecycle.SetCells(_changes);
+
+            this->SendStatus(client, lifecycle);
+            break;
+        }
+        case control_get_region :
+        {
+            int32_t region[4];
+
+            if (length != sizeof region)
+            {
+                static const char error[] = "get_region: expected row, column, height and width";
+                this->Send(client, reply_error, error, sizeof error - 1);
+                break;
+            }
+
+            memcpy(region, payload, sizeof region);
+            this->SendRegion(client, lifecycle, region);
+            break;
+        }
+        case control_subscribe :
+            if (!client.subscribed)
+            {
+                client.subscribed = true;
+                _subscribers++;
+            }
+
+            this->SendKeyFrame(client, lifecycle);
+            break;
+        case control_unsubscribe :
+            if (client.subscribed)
+            {
+                client.subscribed = false;
+                _subscribers--;
+            }
+
+            this->SendStatus(client, lifecycle);
+            break;
+        case control_status :
+            this->SendStatus(client, lifecycle);
+            break;
+        default:
+        {
+            static const char error[] = "unknown command";
+            this->Send(client, reply_error, error, sizeof error - 1);
+            break;
+        }
+    }
+}
+
+/** @fn ControlServer::RunStepJobs(LifeCycle &lifecycle)
+ *  @brief Steps the commanded generations, until the time of this call is used up.
+ */
+void ControlServer::RunStepJobs(LifeCycle &lifecycle)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    while (!_step_jobs.empty())
+    {
+        struct_step_job &job = _step_jobs.front();
+
+        while (job.generations > 0)
+        {
+            lifecycle.LifeRules();
+            this->Broadcast(lifecycle);
+            job.generations--;
+
+            if (std::chrono::steady_clock::now() - start > step_budget)
+            {
+                return;
+            }
+        }
+
+        auto it = _clients.find(job.socket);
+
+        if (it != _clients.end())
+        {
+            this->SendStatus(it->second, lifecycle);
+        }
+
+        _step_jobs.pop_front();
+    }
+}
+
+/** @fn ControlServer::Broadcast(const LifeCycle &lifecycle)
+ *  @brief Sends the changes since the last call to all subscribers.
+ *
+ *  Has to be called after every generation, otherwise two generations end up in one delta.
+ */
+void ControlServer::Broadcast(const LifeCycle &lifecycle)
+{
+    if (_subscribers == 0)
+    {
+        return;
+    }
+
+    GOL_PROFILE_SCOPE("ControlServer::Broadcast");
+
+    lifecycle.ChangedTilesSince(_sent_stamp, _slots);
+
+    if (_slots.empty() && lifecycle.Generation() == _sent_generation)
+    {
+        return;
+    }
+
+    struct_delta_header header = {lifecycle.Generation(), lifecycle.Population(), 0, 0};
+    uint64_t delta[tile_size];
+
+    _message.resize(sizeof header);
+
+    for (int slot : _slots)
+    {
+        uint64_t buffer[tile_size];
+        const uint64_t *rows = lifecycle.TileRows(slot, buffer);
+        uint64_t *shadow = &_shadow[(size_t) slot * tile_size];
+        uint64_t any = 0;
+
+        for (int r = 0; r < tile_size; r++)
+        {
+            delta[r] = rows[r] ^ shadow[r];
+            shadow[r] = rows[r];
+            any |= delta[r];
+        }
+
+        // Changed and changed back in between.
+        if (any == 0)
+        {
+            continue;
+        }
+
+        int32_t position[2] = {lifecycle.tiles[slot].tile_row, lifecycle.tiles[slot].tile_column};
+        Append(_message, position, sizeof position);
+
+        size_t length_offset = _message.size();
+        _message.resize(length_offset + sizeof(uint32_t));
+
+        EncodeTileRows(delta, _message);
+
+        uint32_t code_length = _message.size() - length_offset - sizeof(uint32_t);
+        memcpy(&_message[length_offset], &code_length, sizeof code_length);
+
+        header.tiles++;
+    }
+
+    memcpy(&_message[0], &header, sizeof header);
+
+    _sent_stamp = lifecycle.ChangeStamp();
+    _sent_generation = lifecycle.Generation();
+
+    for (auto &client : _clients)
+    {
+        if (client.second.subscribed)
+        {
+            this->Send(client.second, reply_delta, _message.data(), _message.size());
+        }
+    }
+}
+
+/** @fn ControlServer::SendKeyFrame(struct_client &client, const LifeCycle &lifecycle)
+ *  @brief Sends the whole biotope to a new subscriber.
+ *
+ *  The other subscribers get their pending delta first, so that all of them continue from the same state.
+ */
+void ControlServer::SendKeyFrame(struct_client &client, const LifeCycle &lifecycle)
+{
+    if (_subscribers == 1 && client.subscribed)
+    {
+        // Nobody kept the state up to date.
+        _shadow.resize(lifecycle.tiles.size() * tile_size);
+
+        for (int slot = 0; slot < lifecycle.tiles.size(); slot++)
+        {
+            uint64_t buffer[tile_size];
+
+            memcpy(&_shadow[(size_t) slot * tile_size], lifecycle.TileRows(slot, buffer), tile_size * sizeof(uint64_t));
+        }
+
+        _sent_stamp = lifecycle.ChangeStamp();
+        _sent_generation = lifecycle.Generation();
+    }
+    else
+    {
+        bool subscribed = client.subscribed;
+
+        // Without this client, it gets the full state below.
+        client.subscribed = false;
+        this->Broadcast(lifecycle);
+        client.subscribed = subscribed;
+    }
+
+    struct_delta_header header = {_sent_generation, lifecycle.Population(), 0, 1};
+
+    _message.resize(sizeof header);
+
+    for (int slot = 0; slot < lifecycle.tiles.size(); slot++)
+    {
+        const uint64_t *shadow = &_shadow[(size_t) slot * tile_size];
+        uint64_t any = 0;
+
+        for (int r = 0; r < tile_size; r++)
+        {
+            any |= shadow[r];
+        }
+
+        if (any == 0)
+        {
+            continue;
+        }
+
+        int32_t position[2] = {lifecycle.tiles[slot].tile_row, lifecycle.tiles[slot].tile_column};
+        Append(_message, position, sizeof position);
+
+        size_t length_offset = _message.size();
+        _message.resize(length_offset + sizeof(uint32_t));
+
+        EncodeTileRows(shadow, _message);
+
+        uint32_t code_length = _message.size() - length_offset - sizeof(uint32_t);
+        memcpy(&_message[length_offset], &code_length, sizeof code_length);
+
+        header.tiles++;
+    }
+
+    memcpy(&_message[0], &header, sizeof header);
+
+    this->Send(client, reply_delta, _message.data(), _message.size());
+}
+
+void ControlServer::SendStatus(struct_client &client, const LifeCycle &lifecycle)
+{
+    struct_control_status status = {};
+
+    status.generation = lifecycle.Generation();
+    status.population = lifecycle.Population();
+    status.hash = lifecycle.Hash();
+    status.rows = lifecycle.Rows();
+    status.columns = lifecycle.Columns();
+    status.paused = _paused || !_step_jobs.empty();
+    status.halted = lifecycle.Halted();
+
+    this->Send(client, reply_status, &status, sizeof status);
+}
+
+/** @fn ControlServer::SendRegion(struct_client &client, const LifeCycle &lifecycle, const int32_t *region)
+ *  @brief Sends a rectangle of the biotope as bit rows. Individuals outside of the board are dead.
+ */
+void ControlServer::SendRegion(struct_client &client, const LifeCycle &lifecycle, const int32_t *region)
+{
+    int32_t row = region[0], column = region[1], height = region[2], width = region[3];
+    int64_t words_per_row = ((int64_t) width + tile_size - 1) / tile_size;
+
+    if (height <= 0 || width <= 0 || height * words_per_row * sizeof(uint64_t) > max_payload)
+    {
+        static const char error[] = "get_region: the region is empty or too large";
+        this->Send(client, reply_error, error, sizeof error - 1);
+        return;
+    }
+
+    // One word of a tile row, zero outside of the board.
+    auto board_word = [&](int64_t board_row, int64_t tile_column) -> uint64_t
+    {
+        if (board_row < 0 || board_row >= lifecycle.Rows() || tile_column < 0 || tile_column >= lifecycle.tiles_x)
+        {
+            return 0;
+        }
+
+        return lifecycle.TileRow(lifecycle.TileSlot(board_row / tile_size, tile_column), board_row % tile_size);
+    };
+
+    uint64_t generation = lifecycle.Generation();
+
+    _message.clear();
+    Append(_message, &generation, sizeof generation);
+    Append(_message, region, 4 * sizeof(int32_t));
+
+    size_t offset = _message.size();
+    _message.resize(offset + height * words_per_row * sizeof(uint64_t));
+
+    for (int64_t r = 0; r < height; r++)
+    {
+        for (int64_t w = 0; w < words_per_row; w++)
+        {
+            // Column of bit 0 of this word and its position in the tile grid (rounded down).
+            int64_t first_column = (int64_t) column + w * tile_size;
+            int64_t tile_column = (first_column >= 0 ? first_column : first_column - tile_size + 1) / tile_size;
+            int shift = (int) (first_column - tile_column * tile_size);
+
+            uint64_t word = board_word(row + r, tile_column) >> shift;
+
+            if (shift > 0)
+            {
+                word |= board_word(row + r, tile_column + 1) << (tile_size - shift);
+            }
+
+            // Columns behind the end of the region.
+            if (w == words_per_row - 1 && width % tile_size != 0)
+            {
+                word &= (1ULL << (width % tile_size)) - 1;
+            }
+
+            memcpy(&_message[offset + (r * words_per_row + w) * sizeof(uint64_t)], &word, sizeof word);
+        }
+    }
+
+    this->Send(client, reply_region, _message.data(), _message.size());
+}
+
+/** @fn ControlServer::Send(struct_client &client, uint8_t type, const void *payload, size_t length)
+ *  @brief Queues one message and sends as much as the socket takes.
+ */
+void ControlServer::Send(struct_client &client, uint8_t type, const void *payload, size_t length)
+{
+    if (client.output.size() - client.output_offset + length > max_output)
+    {
+        // The next poll sees the hang up and removes the client.
+        fprintf(stdout,"\nThe control client %i does not read its messages and is disconnected.\n", client.socket);
+        shutdown(client.socket, SHUT_RDWR);
+        client.output.clear();
+        client.output_offset = 0;
+        return;
+    }
+
+    struct_control_header header = {type, {0, 0, 0}, (uint32_t) length};
+
+    Append(client.output, &header, sizeof header);
+    Append(client.output, payload, length);
+
+    this->Flush(client);
+}
+
+void ControlServer::Flush(struct_client &client)
+{
+    while (client.output_offset < client.output.size())
+    {
+        ssize_t sent = send(client.socket, &client.output[client.output_offset],
+                            client.output.size() - client.output_offset, MSG_NOSIGNAL | MSG_DONTWAIT);
+
+        if (sent > 0)
+        {
+            client.output_offset += sent;
+        }
+        else if (sent < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    bool pending = client.output_offset < client.output.size();
+
+    if (!pending)
+    {
+        client.output.clear();
+        client.output_offset = 0;
+    }
+    else if (client.output_offset > (1u << 20))
+    {
+        client.output.erase(client.output.begin(), client.output.begin() + client.output_offset);
+        client.output_offset = 0;
+    }
+
+    // Wait for EPOLLOUT only as long as there is something left to send.
+    if (pending != client.writing)
+    {
+        struct epoll_event event = {};
+        event.events = pending ? EPOLLIN | EPOLLOUT : EPOLLIN;
+        event.data.fd = client.socket;
+
+        epoll_ctl(_epoll, EPOLL_CTL_MOD, client.socket, &event);
+        client.writing = pending;
+    }
+}
+
+void ControlServer::Disconnect(int socket)
+{
+    auto it = _clients.find(socket);
+
+    if (it == _clients.end())
+    {
+        return;
+    }
+
+    if (it->second.subscribed)
+    {
+        _subscribers--;
+    }
+
+    epoll_ctl(_epoll, EPOLL_CTL_DEL, socket, NULL);
+    close(socket);
+
+    _clients.erase(it);
+}
+
+}
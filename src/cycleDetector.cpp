@@ -0,0 +1,90 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    cycleDetector.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Detection of still lifes and oscillating biotopes.
+ *
+ * This program part compares the hash of each new generation with the hashes of the previous generations.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "cycleDetector.hpp"
+
+
+namespace GameOfLife
+{
+
+/** @fn CycleDetector::CycleDetector(int window)
+ *  @brief Constructor of the class CycleDetector.
+ *
+ */
+CycleDetector::CycleDetector(int window)
+{
+    this->_window = window < 1 ? 1 : window;
+    this->_hashes.resize(_window);
+    this->Reset();
+}
+
+/** @fn CycleDetector::~CycleDetector()
+ *  @brief Destructor of the class CycleDetector.
+ *
+ */
+CycleDetector::~CycleDetector()
+{
+}
+
+/** @fn CycleDetector::Reset()
+ *  @brief Forgets all generations, e.g. after the biotope was changed from outside.
+ */
+void CycleDetector::Reset()
+{
+    this->_count = 0;
+    this->_last_generation = 0;
+    this->cycle = {false, 0, 0};
+}
+
+/** @fn CycleDetector::Update(uint64_t generation, uint64_t hash)
+ *  @brief Adds the hash of a new generation. Returns true, if a cycle was found in exactly this generation.
+ *
+ *  The generations have to be consecutive. The first match is the smallest period, because the newest entries are
+ *  compared first. Since every generation is checked, the repeated generation is the start of the cycle.
+ */
+bool CycleDetector::Update(uint64_t generation, uint64_t hash)
+{
+    if (cycle.detected)
+    {
+        return false;
+    }
+
+    if (_count > 0 && generation != _last_generation + 1)
+    {
+        this->Reset();
+    }
+
+    for (int period = 1; period <= _count; period++)
+    {
+        if (_hashes[(generation - period) % _window] == hash)
+        {
+            cycle = {true, (uint64_t) period, generation - period};
+            return true;
+        }
+    }
+
+    _hashes[generation % _window] = hash;
+    _last_generation = generation;
+
+    if (_count < _window)
+    {
+        _count++;
+    }
+
+    return false;
+}
+
+}
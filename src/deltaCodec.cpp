@@ -0,0 +1,186 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    deltaCodec.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Run length code for the 64 rows of one tile.
+ *
+ * This program part packs the differences between two generations of a tile, so that their size follows the number
+ * of changed rows.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <string.h>
+#include "deltaCodec.hpp"
+#include "lifeCycle.hpp"
+
+
+namespace GameOfLife
+{
+/** @fn EncodeTileRows(const uint64_t *rows, std::vector<uint8_t> &code)
+ *  @brief Appends the code of the 64 rows to the end of "code".
+ */
+void EncodeTileRows(const uint64_t *rows, std::vector<uint8_t> &code)
+{
+    int r = 0;
+
+    while (r < tile_size)
+    {
+        int begin = r;
+
+        if (rows[r] == 0)
+        {
+            while (r < tile_size && rows[r] == 0) r++;
+
+            code.push_back((uint8_t) (r - begin - 1));
+        }
+        else
+        {
+            while (r < tile_size && rows[r] != 0) r++;
+
+            code.push_back((uint8_t) (0x80 + r - begin - 1));
+
+            for (int i = begin; i < r; i++)
+            {
+                size_t mask_offset = code.size();
+                uint8_t mask = 0;
+
+                code.push_back(0);
+
+                for (int b = 0; b < 8; b++)
+                {
+                    uint8_t byte = (uint8_t) (rows[i] >> (8 * b));
+
+                    if (byte != 0)
+                    {
+                        mask |= 1 << b;
+                        code.push_back(byte);
+                    }
+                }
+
+                code[mask_offset] = mask;
+            }
+        }
+    }
+}
+
+/** @fn DecodeTileRows(const uint8_t *code, size_t size, uint64_t *rows)
+ *  @brief Decodes the 64 rows and returns the number of bytes used. Returns 0 for a broken code.
+ */
+size_t DecodeTileRows(const uint8_t *code, size_t size, uint64_t *rows)
+{
+    size_t position = 0;
+    int r = 0;
+
+    while (r < tile_size)
+    {
+        if (position >= size)
+        {
+            return 0;
+        }
+
+        uint8_t token = code[position++];
+        int count = (token & 0x7F) + 1;
+
+        if (r + count > tile_size)
+        {
+            return 0;
+        }
+
+        if (token & 0x80)
+        {
+            for (int i = r; i < r + count; i++)
+            {
+                if (position >= size)
+                {
+                    return 0;
+                }
+
+                uint8_t mask = code[position++];
+
+                if ((size_t) __builtin_popcount(mask) > size - position)
+                {
+                    return 0;
+                }
+
+                rows[i] = 0;
+
+                for (int b = 0; b < 8; b++)
+                {
+                    if (mask & (1 << b))
+                    {
+                        rows[i] |= (uint64_t) code[position++] << (8 * b);
+                    }
+                }
+            }
+        }
+        else
+        {
+            memset(&rows[r], 0, count * sizeof(uint64_t));
+        }
+
+        r += count;
+    }
+
+    return position;
+}
+
+/** @fn DecodeTileRow(const uint8_t *code, size_t size, int row)
+ *  @brief Decodes only the given row. Returns 0 for a broken code.
+ *
+ *  The tokens before the row are skipped, the literal rows by the number of bits in their masks.
+ */
+uint64_t DecodeTileRow(const uint8_t *code, size_t size, int row)
+{
+    size_t position = 0;
+    int r = 0;
+
+    while (position < size && r < tile_size)
+    {
+        uint8_t token = code[position++];
+        int count = (token & 0x7F) + 1;
+
+        if (!(token & 0x80))
+        {
+            if (row < r + count)
+            {
+                return 0;
+            }
+
+            r += count;
+            continue;
+        }
+
+        for (int i = 0; i < count && position < size; i++, r++)
+        {
+            uint8_t mask = code[position++];
+
+            if (r < row)
+            {
+                position += __builtin_popcount(mask);
+                continue;
+            }
+
+            uint64_t value = 0;
+
+            for (int b = 0; b < 8 && position < size; b++)
+            {
+                if (mask & (1 << b))
+                {
+                    value |= (uint64_t) code[position++] << (8 * b);
+                }
+            }
+
+            return value;
+        }
+    }
+
+    return 0;
+}
+
+}
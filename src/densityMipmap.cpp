@@ -0,0 +1,214 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    densityMipmap.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Population density of the biotope in several levels of detail.
+ *
+ * This program part calculates the levels 1 to 6 out of the bits of a tile and every further level as average of
+ * four blocks of the level below.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <algorithm>
+
+#include "densityMipmap.hpp"
+
+
+namespace GameOfLife
+{
+    // Level of one block per tile.
+    static constexpr int tile_level = 6;
+
+/** @fn DensityMipmap::DensityMipmap()
+ *  @brief Constructor of the class DensityMipmap.
+ *
+ */
+DensityMipmap::DensityMipmap()
+{
+}
+
+/** @fn DensityMipmap::~DensityMipmap()
+ *  @brief Destructor of the class DensityMipmap.
+ *
+ */
+DensityMipmap::~DensityMipmap()
+{
+}
+
+/** @fn DensityMipmap::Rebuild(const LifeCycle &lifecycle)
+ *  @brief Allocates all levels for the size of the biotope and calculates them from scratch.
+ */
+void DensityMipmap::Rebuild(const LifeCycle &lifecycle)
+{
+    _levels.assign(1, board_vector<uint8_t>());
+    _heat.clear();
+    _rows.assign(1, lifecycle.tiles_y * tile_size);
+    _columns.assign(1, lifecycle.tiles_x * tile_size);
+
+    // Halve the size until a single block covers the whole biotope.
+    while (_rows.back() > 1 || _columns.back() > 1)
+    {
+        _rows.push_back((_rows.back() + 1) / 2);
+        _columns.push_back((_columns.back() + 1) / 2);
+        _levels.emplace_back((size_t) _rows.back() * _columns.back(), 0);
+    }
+
+    if (lifecycle.CellAgesEnabled())
+    {
+        _heat.resize(_levels.size());
+
+        for (int level = 1; level < _levels.size(); level++)
+        {
+            _heat[level].assign(_levels[level].size(), 0);
+        }
+    }
+
+    std::vector<int> slots(lifecycle.tiles.size());
+
+    for (int slot = 0; slot < slots.size(); slot++)
+    {
+        slots[slot] = slot;
+    }
+
+    this->Update(lifecycle, slots);
+}
+
+/** @fn DensityMipmap::Update(const LifeCycle &lifecycle, const std::vector<int> &slots)
+ *  @brief Recalculates the blocks, which contain the given tiles.
+ */
+void DensityMipmap::Update(const LifeCycle &lifecycle, const std::vector<int> &slots)
+{
+    if (_levels.size() <= 1)
+    {
+        return;
+    }
+
+    for (int slot : slots)
+    {
+        this->UpdateTile(lifecycle, slot);
+    }
+
+    // The coarse levels cover several tiles. A block is recalculated once per changed tile below it, which are only
+    // four reads each time.
+    for (int level = tile_level + 1; level < _levels.size(); level++)
+    {
+        for (int slot : slots)
+        {
+            const struct_tile &tile = lifecycle.tiles[slot];
+
+            this->UpdateBlock(level, tile.tile_row >> (level - tile_level), tile.tile_column >> (level - tile_level));
+        }
+    }
+}
+
+void DensityMipmap::UpdateTile(const LifeCycle &lifecycle, int slot)
+{
+    const struct_tile &tile = lifecycle.tiles[slot];
+    uint64_t buffer[tile_size];
+    const uint64_t *rows = lifecycle.TileRows(slot, buffer);
+
+    // Level 1: count the individuals of each 2 x 2 block.
+    int row_offset = tile.tile_row * tile_size / 2;
+    int column_offset = tile.tile_column * tile_size / 2;
+
+    for (int r = 0; r < tile_size / 2; r++)
+    {
+        uint64_t upper = rows[2 * r];
+        uint64_t lower = rows[2 * r + 1];
+
+        uint8_t *block = &_levels[1][(size_t) (row_offset + r) * _columns[1] + column_offset];
+
+        for (int c = 0; c < tile_size / 2; c++)
+        {
+            int count = __builtin_popcountll(((upper >> (2 * c)) & 3) | (((lower >> (2 * c)) & 3) << 2));
+
+            block[c] = (uint8_t) (count * 255 / 4);
+        }
+    }
+
+    if (!_heat.empty())
+    {
+        uint8_t ages[tile_size * tile_size];
+        lifecycle.TileAges(slot, ages);
+
+        for (int r = 0; r < tile_size / 2; r++)
+        {
+            uint8_t *block = &_heat[1][(size_t) (row_offset + r) * _columns[1] + column_offset];
+
+            for (int c = 0; c < tile_size / 2; c++)
+            {
+                int youngest = 256;
+
+                for (int i = 0; i < 4; i++)
+                {
+                    uint8_t age = ages[(2 * r + i / 2) * tile_size + 2 * c + i % 2];
+                    youngest = age > 0 ? std::min<int>(youngest, age) : youngest;
+                }
+
+                block[c] = (uint8_t) (256 - youngest);
+            }
+        }
+    }
+
+    // Level 2 up to the tile level.
+    for (int level = 2; level <= tile_level && level < _levels.size(); level++)
+    {
+        int size = tile_size >> level;
+
+        for (int r = 0; r < size; r++)
+        {
+            for (int c = 0; c < size; c++)
+            {
+                this->UpdateBlock(level, tile.tile_row * size + r, tile.tile_column * size + c);
+            }
+        }
+    }
+}
+
+/** @fn DensityMipmap::UpdateBlock(int level, int row, int column)
+ *  @brief Averages the four blocks of the level below. Blocks outside of the level count as empty.
+ */
+void DensityMipmap::UpdateBlock(int level, int row, int column)
+{
+    const board_vector<uint8_t> &below = _levels[level - 1];
+    int below_rows = _rows[level - 1];
+    int below_columns = _columns[level - 1];
+
+    int sum = 0;
+
+    for (int r = 2 * row; r < 2 * row + 2 && r < below_rows; r++)
+    {
+        for (int c = 2 * column; c < 2 * column + 2 && c < below_columns; c++)
+        {
+            sum += below[(size_t) r * below_columns + c];
+        }
+    }
+
+    _levels[level][(size_t) row * _columns[level] + column] = (uint8_t) ((sum + 2) / 4);
+
+    if (_heat.empty())
+    {
+        return;
+    }
+
+    const board_vector<uint8_t> &heat_below = _heat[level - 1];
+    uint8_t heat = 0;
+
+    for (int r = 2 * row; r < 2 * row + 2 && r < below_rows; r++)
+    {
+        for (int c = 2 * column; c < 2 * column + 2 && c < below_columns; c++)
+        {
+            heat = std::max(heat, heat_below[(size_t) r * below_columns + c]);
+        }
+    }
+
+    _heat[level][(size_t) row * _columns[level] + column] = heat;
+}
+
+}
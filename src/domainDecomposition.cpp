@@ -0,0 +1,774 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    domainDecomposition.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Distribution of one biotope over several processes.
+ *
+ * This program part splits the board, forks the ranks, exchanges the halos between them and collects the view for
+ * the window.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "domainDecomposition.hpp"
+#include "lifeCycle.hpp"
+#include "profiler.hpp"
+
+
+namespace GameOfLife
+{
+/** @fn WriteAll(int socket, const void *data, size_t length)
+ *  @brief Writes the whole buffer into a blocking socket.
+ */
+static bool WriteAll(int socket, const void *data, size_t length)
+{
+    const uint8_t *bytes = (const uint8_t *) data;
+
+    while (length > 0)
+    {
+        ssize_t written = send(socket, bytes, length, MSG_NOSIGNAL);
+
+        if (written < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (written <= 0)
+        {
+            return false;
+        }
+
+        bytes += written;
+        length -= written;
+    }
+
+    return true;
+}
+
+/** @fn ReadAll(int socket, void *data, size_t length)
+ *  @brief Reads exactly "length" bytes from a blocking socket.
+ */
+static bool ReadAll(int socket, void *data, size_t length)
+{
+    uint8_t *bytes = (uint8_t *) data;
+
+    while (length > 0)
+    {
+        ssize_t received = recv(socket, bytes, length, 0);
+
+        if (received < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (received <= 0)
+        {
+            return false;
+        }
+
+        bytes += received;
+        length -= received;
+    }
+
+    return true;
+}
+
+/** @fn DomainRank::DomainRank(const struct_block &block, int control, const int *links, int view_factor)
+ *  @brief Constructor of the class DomainRank.
+ *
+ *  The links are the sockets to the eight neighbours, -1 outside of the board.
+ */
+DomainRank::DomainRank(const struct_block &block, int control, const int *links, int view_factor)
+{
+    this->_block = block;
+    this->_control = control;
+    this->_view_factor = view_factor;
+
+    int tiles_x = (block.columns + tile_size - 1) / tile_size;
+    int tiles_y = (block.rows + tile_size - 1) / tile_size;
+
+    for (int n = 0; n < 8; n++)
+    {
+        struct_link &link = _links[n];
+
+        link.socket = links[n];
+        link.sent = 0;
+        link.received = 0;
+
+        // Rows to the north and south, columns to the west and east, a single cell to the corners.
+        size_t words = (n == 1 || n == 6) ? tiles_x : (n == 3 || n == 4) ? tiles_y : 1;
+
+        link.send.assign(words, 0);
+        link.receive.assign(words, 0);
+
+        if (link.socket >= 0)
+        {
+            fcntl(link.socket, F_SETFL, fcntl(link.socket, F_GETFL) | O_NONBLOCK);
+        }
+    }
+}
+
+/** @fn DomainRank::~DomainRank()
+ *  @brief Destructor of the class DomainRank.
+ *
+ *  This functions closes the sockets of the rank.
+ */
+DomainRank::~DomainRank()
+{
+    for (struct_link &link : _links)
+    {
+        if (link.socket >= 0) close(link.socket);
+    }
+
+    close(_control);
+}
+
+/** @fn DomainRank::Run(std::function<void(LifeCycle &, const struct_block &)> initializer)
+ *  @brief Creates the block and executes the commands of the coordinator until it quits.
+ */
+void DomainRank::Run(std::function<void(LifeCycle &lifecycle, const struct_block &block)> initializer)
+{
+    LifeCycle lifecycle(_block.rows, _block.columns, _block.rows * _block.columns, "empty", " ", 0, false);
+
+    lifecycle.EnableOuterHalo();
+    initializer(lifecycle, _block);
+
+    struct_rank_command command;
+
+    while (ReadAll(_control, &command, sizeof command))
+    {
+        if (command.type == rank_step)
+        {
+            for (uint32_t i = 0; i < command.generations; i++)
+            {
+                if (!this->StepGeneration(lifecycle))
+                {
+                    fprintf(stdout,"\nThe rank %i lost the connection to a neighbour.\n", _block.rank);
+                    return;
+                }
+            }
+        }
+        else if (command.type == rank_gather)
+        {
+            if (!this->SendView(lifecycle))
+            {
+                return;
+            }
+        }
+        else
+        {
+            return;
+        }
+    }
+}
+
+/** @fn DomainRank::StepGeneration(LifeCycle &lifecycle)
+ *  @brief Steps one generation and overlaps the halo exchange with the interior tiles.
+ */
+bool DomainRank::StepGeneration(LifeCycle &lifecycle)
+{
+    // A halted block still has to send its borders to the neighbours.
+    bool stepping = lifecycle.BeginGeneration();
+
+    this->PackBorders(lifecycle);
+
+    if (!this->StartExchange())
+    {
+        return false;
+    }
+
+    if (stepping)
+    {
+        lifecycle.StepInteriorTiles();
+    }
+
+    if (!this->FinishExchange(lifecycle))
+    {
+        return false;
+    }
+
+    if (stepping)
+    {
+        lifecycle.StepBoundaryTiles();
+        lifecycle.CommitGeneration();
+    }
+
+    return true;
+}
+
+/** @fn DomainRank::PackBorders(const LifeCycle &lifecycle)
+ *  @brief Copies the border cells of the block into the send buffers of the links.
+ */
+void DomainRank::PackBorders(const LifeCycle &lifecycle)
+{
+    int last_row = _block.rows - 1, last_column = _block.columns - 1;
+
+    for (int tx = 0; tx < lifecycle.tiles_x; tx++)
+    {
+        _links[1].send[tx] = lifecycle.TileRow(lifecycle.TileSlot(0, tx), 0);
+        _links[6].send[tx] = lifecycle.TileRow(lifecycle.TileSlot(last_row / tile_size, tx), last_row % tile_size);
+    }
+
+    for (int ty = 0; ty < lifecycle.tiles_y; ty++)
+    {
+        uint64_t west_buffer[tile_size], east_buffer[tile_size];
+        const uint64_t *west = lifecycle.TileRows(lifecycle.TileSlot(ty, 0), west_buffer);
+        const uint64_t *east = lifecycle.TileRows(lifecycle.TileSlot(ty, last_column / tile_size), east_buffer);
+
+        uint64_t west_bits = 0, east_bits = 0;
+
+        for (int r = 0; r < tile_size; r++)
+        {
+            west_bits |= (west[r] & 1) << r;
+            east_bits |= ((east[r] >> (last_column % tile_size)) & 1) << r;
+        }
+
+        _links[3].send[ty] = west_bits;
+        _links[4].send[ty] = east_bits;
+    }
+
+    _links[0].send[0] = lifecycle.IsAlive(0, 0);
+    _links[2].send[0] = lifecycle.IsAlive(0, last_column);
+    _links[5].send[0] = lifecycle.IsAlive(last_row, 0);
+    _links[7].send[0] = lifecycle.IsAlive(last_row, last_column);
+}
+
+/** @fn DomainRank::StartExchange()
+ *  @brief Sends as much of the borders as the sockets take without waiting.
+ */
+bool DomainRank::StartExchange()
+{
+    for (struct_link &link : _links)
+    {
+        link.sent = 0;
+        link.received = 0;
+
+        if (link.socket < 0)
+        {
+            continue;
+        }
+
+        ssize_t sent = send(link.socket, link.send.data(), link.send.size() * sizeof(uint64_t),
+                            MSG_NOSIGNAL | MSG_DONTWAIT);
+
+        if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        {
+            return false;
+        }
+
+        link.sent = sent > 0 ? sent : 0;
+    }
+
+    return true;
+}
+
+/** @fn DomainRank::FinishExchange(LifeCycle &lifecycle)
+ *  @brief Completes the exchange and writes the received cells into the outer halo.
+ */
+bool DomainRank::FinishExchange(LifeCycle &lifecycle)
+{
+    GOL_PROFILE_SCOPE("DomainRank::FinishExchange");
+
+    while (true)
+    {
+        struct pollfd polls[8];
+        struct_link *polled[8];
+        int count = 0;
+
+        for (struct_link &link : _links)
+        {
+            size_t bytes = link.send.size() * sizeof(uint64_t);
+
+            if (link.socket < 0 || (link.sent == bytes && link.received == bytes))
+            {
+                continue;
+            }
+
+            polls[count].fd = link.socket;
+            polls[count].events = (link.sent < bytes ? POLLOUT : 0) | (link.received < bytes ? POLLIN : 0);
+            polls[count].revents = 0;
+            polled[count] = &link;
+            count++;
+        }
+
+        if (count == 0)
+        {
+            break;
+        }
+
+        if (poll(polls, count, -1) < 0 && errno != EINTR)
+        {
+            return false;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            struct_link &link = *polled[i];
+            size_t bytes = link.send.size() * sizeof(uint64_t);
+
+            if (polls[i].revents & POLLOUT)
+            {
+                ssize_t sent = send(link.socket, (uint8_t *) link.send.data() + link.sent, bytes - link.sent,
+                                    MSG_NOSIGNAL | MSG_DONTWAIT);
+
+                if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+                {
+                    return false;
+                }
+
+                link.sent += sent > 0 ? sent : 0;
+            }
+
+            if (polls[i].revents & (POLLIN | POLLHUP | POLLERR))
+            {
+                ssize_t received = recv(link.socket, (uint8_t *) link.receive.data() + link.received,
+                                        bytes - link.received, MSG_DONTWAIT);
+
+                if (received == 0 || (received < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+                {
+                    return false;
+                }
+
+                link.received += received > 0 ? received : 0;
+            }
+        }
+    }
+
+    // From the north comes the bottom row of the northern block, and so on.
+    struct_outer_halo &halo = lifecycle.OuterHalo();
+
+    if (_links[1].socket >= 0) halo.north.assign(_links[1].receive.begin(), _links[1].receive.end());
+    if (_links[6].socket >= 0) halo.south.assign(_links[6].receive.begin(), _links[6].receive.end());
+    if (_links[3].socket >= 0) halo.west.assign(_links[3].receive.begin(), _links[3].receive.end());
+    if (_links[4].socket >= 0) halo.east.assign(_links[4].receive.begin(), _links[4].receive.end());
+
+    halo.corners = 0;
+
+    if (_links[0].socket >= 0) halo.corners |= _links[0].receive[0];
+    if (_links[2].socket >= 0) halo.corners |= _links[2].receive[0] << 1;
+    if (_links[5].socket >= 0) halo.corners |= _links[5].receive[0] << 2;
+    if (_links[7].socket >= 0) halo.corners |= _links[7].receive[0] << 3;
+
+    return true;
+}
+
+/** @fn DomainRank::SendView(const LifeCycle &lifecycle)
+ *  @brief Sends the downsampled block to the coordinator.
+ */
+bool DomainRank::SendView(const LifeCycle &lifecycle)
+{
+    int factor = _view_factor;
+    int view_rows = (_block.rows + factor - 1) / factor;
+    int view_columns = (_block.columns + factor - 1) / factor;
+    int words_per_row = (view_columns + tile_size - 1) / tile_size;
+
+    std::vector<uint64_t> view((size_t) view_rows * words_per_row, 0);
+
+    // A group of "factor" bits of a tile row becomes one bit of the view.
+    uint64_t group_mask = factor == tile_size ? ~0ULL : (1ULL << factor) - 1;
+    int groups = tile_size / factor;
+
+    for (int vr = 0; vr < view_rows; vr++)
+    {
+        for (int tx = 0; tx < lifecycle.tiles_x; tx++)
+        {
+            uint64_t any = 0;
+
+            for (int row = vr * factor; row < std::min((vr + 1) * factor, _block.rows); row++)
+            {
+                any |= lifecycle.TileRow(lifecycle.TileSlot(row / tile_size, tx), row % tile_size);
+            }
+
+            for (int g = 0; g < groups && any != 0; g++)
+            {
+                if ((any >> (g * factor)) & group_mask)
+                {
+                    int vc = tx * groups + g;
+                    view[(size_t) vr * words_per_row + vc / tile_size] |= 1ULL << (vc % tile_size);
+                }
+            }
+        }
+    }
+
+    struct_rank_view header = {lifecycle.Generation(), lifecycle.Population(), (uint32_t) view_rows,
+                               (uint32_t) words_per_row};
+
+    return WriteAll(_control, &header, sizeof header) &&
+           WriteAll(_control, view.data(), view.size() * sizeof(uint64_t));
+}
+
+/** @fn DomainDecomposition::DomainDecomposition(int rows, int columns, int ranks, int view_factor)
+ *  @brief Constructor of the class DomainDecomposition.
+ *
+ *  Splits the board into a grid of blocks, which is about as square as possible. The view factor is rounded down to
+ *  a power of two between 1 and 64.
+ */
+DomainDecomposition::DomainDecomposition(int rows, int columns, int ranks, int view_factor)
+{
+    this->_rows = rows;
+    this->_columns = columns;
+    this->_running = false;
+    this->_population = 0;
+    this->_generation = 0;
+
+    _view_factor = 1;
+
+    while (_view_factor * 2 <= std::min(view_factor, tile_size))
+    {
+        _view_factor *= 2;
+    }
+
+    int tiles_x = (columns + tile_size - 1) / tile_size;
+    int tiles_y = (rows + tile_size - 1) / tile_size;
+
+    // A block has at least one tile.
+    ranks = std::max(1, std::min(ranks, tiles_x * tiles_y));
+
+    _ranks_y = 0;
+    _ranks_x = 0;
+    double best = 0.0;
+
+    for (int ranks_y = 1; ranks_y <= ranks; ranks_y++)
+    {
+        int ranks_x = ranks / ranks_y;
+
+        if (ranks_y * ranks_x != ranks || ranks_y > tiles_y || ranks_x > tiles_x)
+        {
+            continue;
+        }
+
+        // Aspect ratio of the blocks, 1 for square blocks.
+        double aspect = ((double) rows / ranks_y) / ((double) columns / ranks_x);
+        double score = std::fabs(std::log(aspect));
+
+        if (_ranks_y == 0 || score < best)
+        {
+            _ranks_y = ranks_y;
+            _ranks_x = ranks_x;
+            best = score;
+        }
+    }
+
+    // A prime number of ranks larger than the tiles in one direction.
+    if (_ranks_y == 0)
+    {
+        _ranks_y = 1;
+        _ranks_x = std::min(ranks, tiles_x);
+    }
+
+    static int constexpr offsets[8][2] = {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}};
+
+    for (int by = 0; by < _ranks_y; by++)
+    {
+        for (int bx = 0; bx < _ranks_x; bx++)
+        {
+            struct_block block;
+
+            block.rank = by * _ranks_x + bx;
+            block.block_row = by;
+            block.block_column = bx;
+
+            // The blocks end at tile borders, only the last ones can end within a tile.
+            int ty0 = tiles_y * by / _ranks_y, ty1 = tiles_y * (by + 1) / _ranks_y;
+            int tx0 = tiles_x * bx / _ranks_x, tx1 = tiles_x * (bx + 1) / _ranks_x;
+
+            block.row0 = ty0 * tile_size;
+            block.column0 = tx0 * tile_size;
+            block.rows = std::min(ty1 * tile_size, rows) - block.row0;
+            block.columns = std::min(tx1 * tile_size, columns) - block.column0;
+
+            for (int n = 0; n < 8; n++)
+            {
+                int y = by + offsets[n][0], x = bx + offsets[n][1];
+
+                block.neighbours[n] = (y < 0 || y >= _ranks_y || x < 0 || x >= _ranks_x) ? -1 : y * _ranks_x + x;
+            }
+
+            _blocks.push_back(block);
+        }
+    }
+
+    fprintf(stdout,"The biotope is distributed over %i x %i ranks, a window individual stands for %i x %i.\n",
+            _ranks_y, _ranks_x, _view_factor, _view_factor);
+}
+
+/** @fn DomainDecomposition::~DomainDecomposition()
+ *  @brief Destructor of the class DomainDecomposition.
+ *
+ *  This functions stops all ranks and waits for them.
+ */
+DomainDecomposition::~DomainDecomposition()
+{
+    this->Stop();
+}
+
+/** @fn DomainDecomposition::Start(std::function<void(LifeCycle &, const struct_block &)> initializer)
+ *  @brief Connects and forks the ranks. The initializer is called in each rank for its own block.
+ */
+bool DomainDecomposition::Start(std::function<void(LifeCycle &lifecycle, const struct_block &block)> initializer)
+{
+    int ranks = _blocks.size();
+
+    // All sockets exist before the first fork, so every rank finds the ends of its links.
+    std::vector<int> control_child(ranks, -1);
+    std::vector<std::array<int, 8>> links(ranks);
+
+    _control.assign(ranks, -1);
+
+    for (int rank = 0; rank < ranks; rank++)
+    {
+        links[rank].fill(-1);
+    }
+
+    bool connected = true;
+
+    for (int rank = 0; rank < ranks && connected; rank++)
+    {
+        int pair[2];
+
+        connected = socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, pair) == 0;
+
+        if (connected)
+        {
+            _control[rank] = pair[0];
+            control_child[rank] = pair[1];
+        }
+
+        for (int n = 0; n < 8 && connected; n++)
+        {
+            int neighbour = _blocks[rank].neighbours[n];
+
+            // Each pair of neighbours once. The direction 7 - n points back.
+            if (neighbour > rank)
+            {
+                connected = socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, pair) == 0;
+
+                if (connected)
+                {
+                    links[rank][n] = pair[0];
+                    links[neighbour][7 - n] = pair[1];
+                }
+            }
+        }
+    }
+
+    auto close_child_ends = [&](int keep)
+    {
+        for (int rank = 0; rank < ranks; rank++)
+        {
+            if (rank == keep)
+            {
+                continue;
+            }
+
+            if (control_child[rank] >= 0) close(control_child[rank]);
+
+            for (int n = 0; n < 8; n++)
+            {
+                if (links[rank][n] >= 0) close(links[rank][n]);
+            }
+        }
+    };
+
+    if (!connected)
+    {
+        fprintf(stdout,"Cannot connect the ranks: %s\n", strerror(errno));
+        close_child_ends(-1);
+        return false;
+    }
+
+    fflush(stdout);
+
+    for (int rank = 0; rank < ranks; rank++)
+    {
+        pid_t pid = fork();
+
+        if (pid == 0)
+        {
+            // The rank keeps only its own sockets.
+            close_child_ends(rank);
+
+            for (int socket : _control)
+            {
+                close(socket);
+            }
+
+            {
+                DomainRank domain_rank(_blocks[rank], control_child[rank], links[rank].data(), _view_factor);
+                domain_rank.Run(initializer);
+            }
+
+            fflush(stdout);
+            _exit(0);
+        }
+
+        if (pid < 0)
+        {
+            fprintf(stdout,"Cannot start the rank %i: %s\n", rank, strerror(errno));
+            break;
+        }
+
+        _pids.push_back(pid);
+    }
+
+    close_child_ends(-1);
+    _running = _pids.size() == ranks;
+
+    if (!_running)
+    {
+        this->Stop();
+    }
+
+    return _running;
+}
+
+/** @fn DomainDecomposition::Step(int generations)
+ *  @brief Lets all ranks step. Returns without waiting for them.
+ */
+bool DomainDecomposition::Step(int generations)
+{
+    struct_rank_command command = {rank_step, (uint32_t) generations};
+
+    for (int socket : _control)
+    {
+        if (!_running || !WriteAll(socket, &command, sizeof command))
+        {
+            _running = false;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/** @fn DomainDecomposition::Gather(LifeCycle &view)
+ *  @brief Waits for the ranks and loads the downsampled biotope into the view.
+ *
+ *  The view life cycle must have the size ViewRows() x ViewColumns().
+ */
+bool DomainDecomposition::Gather(LifeCycle &view)
+{
+    GOL_PROFILE_SCOPE("DomainDecomposition::Gather");
+
+    struct_rank_command command = {rank_gather, 0};
+
+    for (int socket : _control)
+    {
+        if (!_running || !WriteAll(socket, &command, sizeof command))
+        {
+            _running = false;
+            return false;
+        }
+    }
+
+    int words_per_row = view.tiles_x;
+
+    _view_rows.assign((size_t) this->ViewRows() * words_per_row, 0);
+    _population = 0;
+
+    for (const struct_block &block : _blocks)
+    {
+        struct_rank_view header;
+
+        if (!ReadAll(_control[block.rank], &header, sizeof header))
+        {
+            fprintf(stdout,"\nThe rank %i does not answer any more.\n", block.rank);
+            _running = false;
+            return false;
+        }
+
+        _block_view.resize((size_t) header.rows * header.words_per_row);
+
+        if (!ReadAll(_control[block.rank], _block_view.data(), _block_view.size() * sizeof(uint64_t)))
+        {
+            _running = false;
+            return false;
+        }
+
+        _population += header.population;
+        _generation = header.generation;
+
+        // The block starts at a tile border, in the view that is a multiple of 64 / view_factor.
+        int view_row0 = block.row0 / _view_factor;
+        int view_column0 = block.column0 / _view_factor;
+
+        for (uint32_t r = 0; r < header.rows; r++)
+        {
+            uint64_t *row = &_view_rows[(size_t) (view_row0 + r) * words_per_row];
+
+            for (uint32_t w = 0; w < header.words_per_row; w++)
+            {
+                uint64_t word = _block_view[(size_t) r * header.words_per_row + w];
+                int position = view_column0 + w * tile_size;
+                int shift = position % tile_size;
+
+                row[position / tile_size] |= word << shift;
+
+                if (shift > 0 && position / tile_size + 1 < words_per_row)
+                {
+                    row[position / tile_size + 1] |= word >> (tile_size - shift);
+                }
+            }
+        }
+    }
+
+    // Row by row into the order of the tiles.
+    _view_tiles.assign(view.tiles.size() * tile_size, 0);
+
+    for (int vr = 0; vr < this->ViewRows(); vr++)
+    {
+        for (int w = 0; w < words_per_row; w++)
+        {
+            _view_tiles[((size_t) (vr / tile_size) * words_per_row + w) * tile_size + vr % tile_size] =
+                _view_rows[(size_t) vr * words_per_row + w];
+        }
+    }
+
+    view.LoadTiles(_view_tiles, _generation);
+
+    return true;
+}
+
+void DomainDecomposition::Stop()
+{
+    struct_rank_command command = {rank_quit, 0};
+
+    for (int socket : _control)
+    {
+        if (socket >= 0)
+        {
+            WriteAll(socket, &command, sizeof command);
+            close(socket);
+        }
+    }
+
+    _control.clear();
+
+    for (pid_t pid : _pids)
+    {
+        waitpid(pid, NULL, 0);
+    }
+
+    _pids.clear();
+    _running = false;
+}
+
+}
@@ -0,0 +1,462 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    edgeMonitor.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Removal of spaceships, which leave the biotope.
+ *
+ * This program part builds the table of the spaceship phases and looks for them at the border of the biotope.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <algorithm>
+#include <unordered_set>
+
+#include "edgeMonitor.hpp"
+#include "profiler.hpp"
+
+
+namespace GameOfLife
+{
+/** @fn ShapeHash(int height, int width, const std::vector<uint64_t> &rows)
+ *  @brief Hash of a shape in its orientation, bit c of rows[r] is the individual in row r and column c.
+ */
+static uint64_t ShapeHash(int height, int width, const std::vector<uint64_t> &rows)
+{
+    uint64_t hash = (uint64_t) height << 8 | width;
+
+    for (uint64_t row : rows)
+    {
+        hash = (hash ^ row) * 0x100000001B3ULL;
+        hash ^= hash >> 29;
+    }
+
+    return hash;
+}
+
+/** @fn StepCells(std::vector<std::pair<int, int>> &cells)
+ *  @brief Next generation of a small pattern on an unbounded plane.
+ */
+static void StepCells(std::vector<std::pair<int, int>> &cells)
+{
+    std::unordered_map<uint64_t, int> counts;
+    std::unordered_set<uint64_t> alive;
+
+    auto key = [](int row, int column) { return (uint64_t) (uint32_t) row << 32 | (uint32_t) column; };
+
+    for (const std::pair<int, int> &cell : cells)
+    {
+        alive.insert(key(cell.first, cell.second));
+
+        for (int dr = -1; dr <= 1; dr++)
+        {
+            for (int dc = -1; dc <= 1; dc++)
+            {
+                if (dr != 0 || dc != 0)
+                {
+                    counts[key(cell.first + dr, cell.second + dc)]++;
+                }
+            }
+        }
+    }
+
+    cells.clear();
+
+    for (const std::pair<const uint64_t, int> &count : counts)
+    {
+        if (count.second == 3 || (count.second == 2 && alive.count(count.first)))
+        {
+            cells.push_back({(int) (uint32_t) (count.first >> 32), (int) (uint32_t) count.first});
+        }
+    }
+}
+
+/** @fn EdgeMonitor::EdgeMonitor(int margin, int rows, int columns)
+ *  @brief Constructor of the class EdgeMonitor for a biotope of rows x columns individuals.
+ *
+ *  The margin has to leave a spaceship some room before it touches the border, so it is at least max_ship_size.
+ *  The cluster of an individual within the margin is given up, when it is larger than a spaceship. Until then it
+ *  reaches max_ship_size + 2 individuals beyond the margin, its neighbours 2 more: that is the width of the band.
+ */
+EdgeMonitor::EdgeMonitor(int margin, int rows, int columns)
+{
+    this->_margin = std::max(margin, max_ship_size);
+    this->_emitted = 0;
+
+    int reach = _margin + max_ship_size + 4;
+
+    this->_rows = rows;
+    this->_columns = columns;
+    this->_band_north = std::min(reach, (rows + 1) / 2);
+    this->_band_south = std::min(reach, rows - _band_north);
+    this->_band_west = std::min(reach, (columns + 1) / 2);
+    this->_band_east = std::min(reach, columns - _band_west);
+
+    this->_visited.assign((size_t) (_band_north + _band_south) * columns +
+                          (size_t) (rows - _band_north - _band_south) * (_band_west + _band_east), 0);
+    this->_visited_dirty = false;
+
+    // A cluster fits into a small square, before it is given up. The removals of a check are a few spaceships.
+    this->_shape.reserve(max_ship_size);
+    this->_cluster.reserve((max_ship_size + 5) * (max_ship_size + 5));
+    this->_stack.reserve((max_ship_size + 5) * (max_ship_size + 5));
+    this->_removals.reserve(4 * max_ship_size * max_ship_size);
+
+    this->AddShip("glider", ".O./..O/OOO");
+    this->AddShip("lwss", ".O..O/O..../O...O/OOOO.");
+    this->AddShip("mwss", "...O../.O...O/O...../O....O/OOOOO.");
+    this->AddShip("hwss", "...OO../.O....O/O....../O.....O/OOOOOO.");
+}
+
+/** @fn EdgeMonitor::~EdgeMonitor()
+ *  @brief Destructor of the class EdgeMonitor.
+ *
+ */
+EdgeMonitor::~EdgeMonitor()
+{
+
+}
+
+/** @fn EdgeMonitor::AddShip(std::string name, std::string pattern)
+ *  @brief Adds all phases of a spaceship in all 8 orientations. The pattern is plain text, rows separated by "/".
+ */
+void EdgeMonitor::AddShip(std::string name, std::string pattern)
+{
+    std::vector<std::pair<int, int>> base;
+    int row = 0, column = 0;
+
+    for (char symbol : pattern)
+    {
+        if (symbol == '/')
+        {
+            row++;
+            column = 0;
+            continue;
+        }
+
+        if (symbol == 'O')
+        {
+            base.push_back({row, column});
+        }
+
+        column++;
+    }
+
+    int ship = _ship_names.size();
+    _ship_names.push_back(name);
+    _ship_counts.push_back(0);
+
+    // Bit 0 transposes, bit 1 flips the rows, bit 2 flips the columns.
+    for (int symmetry = 0; symmetry < 8; symmetry++)
+    {
+        std::vector<std::pair<int, int>> cells;
+
+        for (const std::pair<int, int> &cell : base)
+        {
+            int r = symmetry & 1 ? cell.second : cell.first, c = symmetry & 1 ? cell.first : cell.second;
+            cells.push_back({symmetry & 2 ? -r : r, symmetry & 4 ? -c : c});
+        }
+
+        std::vector<struct_ship_phase> phases;
+        std::vector<std::pair<int, int>> origins;
+
+        // A spaceship comes back after at most 4 generations (the ones in the table do).
+        for (int generation = 0; generation <= 4; generation++)
+        {
+            struct_ship_phase phase = {ship, 0, 0, {}, 0, 0};
+            int top = cells[0].first, bottom = top, left = cells[0].second, right = left;
+
+            for (const std::pair<int, int> &cell : cells)
+            {
+                top = std::min(top, cell.first);
+                bottom = std::max(bottom, cell.first);
+                left = std::min(left, cell.second);
+                right = std::max(right, cell.second);
+            }
+
+            phase.height = bottom - top + 1;
+            phase.width = right - left + 1;
+            phase.rows.assign(phase.height, 0);
+
+            for (const std::pair<int, int> &cell : cells)
+            {
+                phase.rows[cell.first - top] |= 1ULL << (cell.second - left);
+            }
+
+            if (generation > 0 && phase.rows == phases[0].rows && phase.height == phases[0].height)
+            {
+                // Back in the first phase, only moved: the direction is the same for all phases.
+                for (struct_ship_phase &known : phases)
+                {
+                    known.direction_row = top - origins[0].first;
+                    known.direction_column = left - origins[0].second;
+
+                    _phases.insert({ShapeHash(known.height, known.width, known.rows), known});
+                }
+
+                break;
+            }
+
+            phases.push_back(phase);
+            origins.push_back({top, left});
+            StepCells(cells);
+        }
+    }
+}
+
+/** @fn EdgeMonitor::BandIndex(int row, int column)
+ *  @brief Index of an individual in _visited, -1 for an individual beyond the band.
+ */
+int EdgeMonitor::BandIndex(int row, int column) const
+{
+    if (row < _band_north)
+    {
+        return row * _columns + column;
+    }
+
+    if (row >= _rows - _band_south)
+    {
+        return (row - _rows + _band_south + _band_north) * _columns + column;
+    }
+
+    int inner = (_band_north + _band_south) * _columns + (row - _band_north) * (_band_west + _band_east);
+
+    if (column < _band_west)
+    {
+        return inner + column;
+    }
+
+    if (column >= _columns - _band_east)
+    {
+        return inner + _band_west + column - _columns + _band_east;
+    }
+
+    return -1;
+}
+
+/** @fn EdgeMonitor::Check(LifeCycle &lifecycle)
+ *  @brief Looks for escaping spaceships in the margin of the border tiles, which changed in the last generation.
+ */
+void EdgeMonitor::Check(LifeCycle &lifecycle)
+{
+    GOL_PROFILE_SCOPE("LifeRules::edges");
+
+    _removals.clear();
+
+    int rows = lifecycle.Rows(), columns = lifecycle.Columns();
+
+    if (_visited_dirty)
+    {
+        std::fill(_visited.begin(), _visited.end(), 0);
+        _visited_dirty = false;
+    }
+
+    for (int slot : lifecycle.changed_tiles)
+    {
+        const struct_tile &tile = lifecycle.tiles[slot];
+
+        if (tile.tile_row > 0 && tile.tile_row < lifecycle.tiles_y - 1 &&
+            tile.tile_column > 0 && tile.tile_column < lifecycle.tiles_x - 1)
+        {
+            continue;
+        }
+
+        // Columns of the tile within the margin of the west or east border.
+        uint64_t column_margin = 0;
+
+        for (int c = 0; c < tile_size; c++)
+        {
+            int column = tile.tile_column * tile_size + c;
+
+            if (column < _margin || (column >= columns - _margin && column < columns))
+            {
+                column_margin |= 1ULL << c;
+            }
+        }
+
+        uint64_t buffer[tile_size];
+        const uint64_t *cells = lifecycle.TileRows(slot, buffer);
+
+        for (int r = 0; r < tile.valid_rows; r++)
+        {
+            int row = tile.tile_row * tile_size + r;
+            uint64_t bits = row < _margin || row >= rows - _margin ? cells[r] : cells[r] & column_margin;
+
+            for (; bits != 0; bits &= bits - 1)
+            {
+                int column = tile.tile_column * tile_size + __builtin_ctzll(bits);
+
+                if (!_visited[this->BandIndex(row, column)])
+                {
+                    this->Inspect(lifecycle, row, column);
+                }
+            }
+        }
+    }
+
+    if (!_removals.empty())
+    {
+        lifecycle.SetCells(_removals);
+    }
+}
+
+/** @fn EdgeMonitor::Inspect(LifeCycle &lifecycle, int row, int column)
+ *  @brief Collects the cluster around an individual and queues its removal, if it is an escaping spaceship.
+ *
+ *  The cluster holds all individuals, which are at most two rows and columns apart, as in the census. Clusters
+ *  larger than a spaceship are given up early, also the ones, which reach beyond the band.
+ */
+void EdgeMonitor::Inspect(LifeCycle &lifecycle, int row, int column)
+{
+    int rows = lifecycle.Rows(), columns = lifecycle.Columns();
+    int top = row, bottom = row, left = column, right = column;
+    bool too_large = false;
+
+    _cluster.clear();
+    _stack.assign(1, {row, column});
+    _visited[this->BandIndex(row, column)] = 1;
+    _visited_dirty = true;
+
+    while (!_stack.empty() && !too_large)
+    {
+        std::pair<int, int> cell = _stack.back();
+        _stack.pop_back();
+        _cluster.push_back(cell);
+
+        top = std::min(top, cell.first);
+        bottom = std::max(bottom, cell.first);
+        left = std::min(left, cell.second);
+        right = std::max(right, cell.second);
+        too_large = bottom - top >= max_ship_size || right - left >= max_ship_size;
+
+        for (int r = std::max(cell.first - 2, 0); r <= std::min(cell.first + 2, rows - 1); r++)
+        {
+            for (int c = std::max(cell.second - 2, 0); c <= std::min(cell.second + 2, columns - 1); c++)
+            {
+                if (!lifecycle.IsAlive(r, c))
+                {
+                    continue;
+                }
+
+                int index = this->BandIndex(r, c);
+
+                if (index < 0)
+                {
+                    too_large = true;
+                }
+                else if (!_visited[index])
+                {
+                    _visited[index] = 1;
+                    _stack.push_back({r, c});
+                }
+            }
+        }
+    }
+
+    if (too_large)
+    {
+        return;
+    }
+
+    int height = bottom - top + 1, width = right - left + 1;
+    _shape.assign(height, 0);
+
+    for (const std::pair<int, int> &cell : _cluster)
+    {
+        _shape[cell.first - top] |= 1ULL << (cell.second - left);
+    }
+
+    auto range = _phases.equal_range(ShapeHash(height, width, _shape));
+
+    for (auto it = range.first; it != range.second; it++)
+    {
+        const struct_ship_phase &phase = it->second;
+
+        if (phase.height != height || phase.width != width || phase.rows != _shape)
+        {
+            continue;
+        }
+
+        // Only a border within the margin, which the spaceship flies to, lets it escape.
+        bool north = phase.direction_row < 0 && top < _margin;
+        bool south = phase.direction_row > 0 && bottom >= rows - _margin;
+        bool west = phase.direction_column < 0 && left < _margin;
+        bool east = phase.direction_column > 0 && right >= columns - _margin;
+
+        if (!(north || south || west || east) ||
+            !this->PathIsClear(lifecycle, top, bottom, left, right, phase, north, south, west, east))
+        {
+            return;
+        }
+
+        for (const std::pair<int, int> &cell : _cluster)
+        {
+            _removals.push_back({cell.first, cell.second, false});
+        }
+
+        _ship_counts[phase.ship]++;
+        _emitted++;
+        return;
+    }
+}
+
+/** @fn EdgeMonitor::PathIsClear(...)
+ *  @brief True, if only the spaceship itself lives in the area, which it crosses on its way out.
+ *
+ *  The area reaches up to the border, which the spaceship flies to, and two individuals further than the spaceship
+ *  to all other sides. Until it leaves the biotope, the spaceship moves at most by the margin along the border.
+ */
+bool EdgeMonitor::PathIsClear(const LifeCycle &lifecycle, int top, int bottom, int left, int right,
+                              const struct_ship_phase &phase, bool north, bool south, bool west, bool east) const
+{
+    int row0 = north ? 0 : top - 2 - (phase.direction_row < 0 ? _margin : 0);
+    int row1 = south ? lifecycle.Rows() - 1 : bottom + 2 + (phase.direction_row > 0 ? _margin : 0);
+    int column0 = west ? 0 : left - 2 - (phase.direction_column < 0 ? _margin : 0);
+    int column1 = east ? lifecycle.Columns() - 1 : right + 2 + (phase.direction_column > 0 ? _margin : 0);
+
+    row0 = std::max(row0, 0);
+    row1 = std::min(row1, lifecycle.Rows() - 1);
+    column0 = std::max(column0, 0);
+    column1 = std::min(column1, lifecycle.Columns() - 1);
+
+    for (int row = row0; row <= row1; row++)
+    {
+        for (int column = column0; column <= column1; column++)
+        {
+            bool own = row >= top && row <= bottom && column >= left && column <= right &&
+                       ((phase.rows[row - top] >> (column - left)) & 1);
+
+            if (!own && lifecycle.IsAlive(row, column))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+std::string EdgeMonitor::Describe() const
+{
+    std::string text = std::to_string(_emitted) + (_emitted == 1 ? " spaceship" : " spaceships") +
+                       " left the biotope";
+    std::string kinds;
+
+    for (size_t ship = 0; ship < _ship_names.size(); ship++)
+    {
+        if (_ship_counts[ship] > 0)
+        {
+            kinds += (kinds.empty() ? "" : ", ") + _ship_names[ship] + ": " + std::to_string(_ship_counts[ship]);
+        }
+    }
+
+    return kinds.empty() ? text : text + " (" + kinds + ")";
+}
+
+}
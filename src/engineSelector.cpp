@@ -0,0 +1,131 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    engineSelector.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Choice of the step mode from the measured state of the biotope.
+ *
+ * This program part applies the thresholds with hysteresis and writes the stats file.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <errno.h>
+#include <string.h>
+#include "engineSelector.hpp"
+
+
+namespace GameOfLife
+{
+    // Switch to the full sweep above, back to the active tiles below. The gap is the hysteresis.
+    static constexpr double full_sweep_enter = 0.90;
+    static constexpr double full_sweep_leave = 0.70;
+
+    // Number of samples, which a new step mode is kept at least.
+    static constexpr int minimum_dwell = 4;
+
+    static const char *StepModeName(step_mode mode)
+    {
+        return mode == step_mode::full_sweep ? "full_sweep" : mode == step_mode::events ? "events" : "active_tiles";
+    }
+
+/** @fn EngineSelector::EngineSelector(bool verbose)
+ *  @brief Constructor of the class EngineSelector.
+ *
+ */
+EngineSelector::EngineSelector(bool verbose)
+{
+    this->_adaptive = false;
+    this->_verbose = verbose;
+    this->_interval = 32;
+    this->_intervals_since_switch = minimum_dwell;
+    this->_switches = 0;
+    this->_stats = nullptr;
+}
+
+/** @fn EngineSelector::~EngineSelector()
+ *  @brief Destructor of the class EngineSelector.
+ *
+ *  This functions closes the stats file.
+ */
+EngineSelector::~EngineSelector()
+{
+    if (_stats != nullptr)
+    {
+        fclose(_stats);
+    }
+}
+
+/** @fn EngineSelector::OpenStats(std::string path)
+ *  @brief Writes every sample as one line into a CSV file.
+ */
+void EngineSelector::OpenStats(std::string path)
+{
+    if (_stats != nullptr)
+    {
+        fclose(_stats);
+    }
+
+    _stats = fopen(path.c_str(), "w");
+
+    if (_stats == nullptr)
+    {
+        fprintf(stdout,"Cannot open the stats file %s: %s\n", path.c_str(), strerror(errno));
+        return;
+    }
+
+    fprintf(_stats, "generation,population,density,active_fraction,stepped_fraction,churn,generations_per_second,"
+                    "step_mode,switch\n");
+
+    if (_verbose) fprintf(stdout,"Every %i generations the stats are written to %s.\n", _interval, path.c_str());
+}
+
+/** @fn EngineSelector::Select(const struct_engine_sample &sample, step_mode current)
+ *  @brief Returns the step mode for the next interval.
+ */
+step_mode EngineSelector::Select(const struct_engine_sample &sample, step_mode current)
+{
+    step_mode next = current;
+
+    _intervals_since_switch++;
+
+    if (_adaptive && _intervals_since_switch >= minimum_dwell)
+    {
+        if (current == step_mode::active_tiles && sample.active_fraction >= full_sweep_enter)
+        {
+            next = step_mode::full_sweep;
+        }
+        else if (current == step_mode::full_sweep && sample.active_fraction < full_sweep_leave)
+        {
+            next = step_mode::active_tiles;
+        }
+    }
+
+    if (next != current)
+    {
+        _switches++;
+        _intervals_since_switch = 0;
+
+        if (_verbose)
+        {
+            fprintf(stdout,"\nGeneration %lu: the step mode changes from %s to %s (density %.3f, active tiles "
+                    "%.1f %%).\n", (unsigned long) sample.generation, StepModeName(current), StepModeName(next),
+                    sample.density, 100.0 * sample.active_fraction);
+        }
+    }
+
+    if (_stats != nullptr)
+    {
+        fprintf(_stats, "%lu,%lu,%.6f,%.6f,%.6f,%.6f,%.1f,%s,%s\n", (unsigned long) sample.generation,
+                (unsigned long) sample.population, sample.density, sample.active_fraction, sample.stepped_fraction,
+                sample.churn, sample.generations_per_second, StepModeName(next), next != current ? "yes" : "no");
+    }
+
+    return next;
+}
+
+}
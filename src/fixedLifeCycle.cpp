@@ -0,0 +1,77 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    fixedLifeCycle.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Life cycle with the size of the biotope and the rule fixed at compile time.
+ *
+ * This program part builds the instantiations for the common sizes and chooses one of them at runtime.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <functional>
+#include <unordered_map>
+
+#include "fixedLifeCycle.hpp"
+
+
+namespace GameOfLife
+{
+    template class FixedLifeCycle<256, 256, ConwayRule>;
+    template class FixedLifeCycle<512, 512, ConwayRule>;
+    template class FixedLifeCycle<1024, 1024, ConwayRule>;
+    template class FixedLifeCycle<2048, 2048, ConwayRule>;
+    template class FixedLifeCycle<4096, 4096, ConwayRule>;
+    template class FixedLifeCycle<16384, 16384, ConwayRule>;
+    template class FixedLifeCycle<1024, 1024, HighLifeRule>;
+    template class FixedLifeCycle<4096, 4096, HighLifeRule>;
+
+    template<int BoardRows, int BoardColumns, class Rule>
+    static std::unique_ptr<FixedBoard> Create(int threads)
+    {
+        return std::unique_ptr<FixedBoard>(new FixedLifeCycle<BoardRows, BoardColumns, Rule>(threads));
+    }
+
+/** @fn CreateFixedLifeCycle(int rows, int columns, std::string rule, int threads)
+ *  @brief Looks up the instantiation for the size and the rule.
+ *
+ *  The rule is written in its canonical form first, so "b3/s23" or "B3S32" find the instantiation of "B3/S23".
+ */
+std::unique_ptr<FixedBoard> CreateFixedLifeCycle(int rows, int columns, std::string rule, int threads)
+{
+    // Schema: "rows x columns rule"
+    static const std::unordered_map<std::string, std::function<std::unique_ptr<FixedBoard>(int)>> instantiations =
+    {
+        {"256x256 B3/S23", Create<256, 256, ConwayRule>},
+        {"512x512 B3/S23", Create<512, 512, ConwayRule>},
+        {"1024x1024 B3/S23", Create<1024, 1024, ConwayRule>},
+        {"2048x2048 B3/S23", Create<2048, 2048, ConwayRule>},
+        {"4096x4096 B3/S23", Create<4096, 4096, ConwayRule>},
+        {"16384x16384 B3/S23", Create<16384, 16384, ConwayRule>},
+        {"1024x1024 B36/S23", Create<1024, 1024, HighLifeRule>},
+        {"4096x4096 B36/S23", Create<4096, 4096, HighLifeRule>}
+    };
+
+    struct_rule parsed;
+
+    if (!ParseRule(rule, parsed))
+    {
+        return nullptr;
+    }
+
+    auto it = instantiations.find(std::to_string(rows) + "x" + std::to_string(columns) + " " + RuleName(parsed));
+
+    if (it == instantiations.end())
+    {
+        return nullptr;
+    }
+
+    return it->second(threads);
+}
+
+}
@@ -0,0 +1,212 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    framePipeline.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Steps the biotope on its own thread, while the window shows the generations before.
+ *
+ * This program part runs the stepping thread and moves the frames and edits between the threads.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "framePipeline.hpp"
+#include "profiler.hpp"
+
+
+namespace GameOfLife
+{
+
+/** @fn FramePipeline::FramePipeline(LifeCycle &lifecycle, LifeCycle &view, int depth)
+ *  @brief Constructor of the class FramePipeline.
+ *
+ *  Copies the whole biotope into the view and starts the stepping thread.
+ */
+FramePipeline::FramePipeline(LifeCycle &lifecycle, LifeCycle &view, int depth)
+    : _lifecycle(lifecycle), _view(view), _free_frames(depth < 1 ? 1 : depth), _ready_frames(depth < 1 ? 1 : depth),
+      _edits(16)
+{
+    this->_frames.resize(depth < 1 ? 1 : depth);
+    this->_frames_shown = 0;
+    this->_frames_missed = 0;
+    this->_generations_stepped = 0;
+    this->_step_wait_microseconds = 0;
+    this->_stop = false;
+
+    for (int index = 0; index < _frames.size(); index++)
+    {
+        _free_frames.TryPush(index);
+    }
+
+    std::vector<int> slots(lifecycle.tiles.size());
+    std::vector<uint64_t> rows(slots.size() * tile_size);
+    std::vector<uint8_t> ages(lifecycle.CellAgesEnabled() ? slots.size() * tile_size * tile_size : 0);
+
+    for (int slot = 0; slot < slots.size(); slot++)
+    {
+        slots[slot] = slot;
+        memcpy(&rows[(size_t) slot * tile_size], lifecycle.TileRows(slot, &rows[(size_t) slot * tile_size]),
+               tile_size * sizeof(uint64_t));
+
+        if (!ages.empty())
+        {
+            lifecycle.TileAges(slot, &ages[(size_t) slot * tile_size * tile_size]);
+        }
+    }
+
+    view.CopyTiles(slots, rows.data(), lifecycle.Generation(), ages.empty() ? nullptr : ages.data());
+
+    _capture_stamp = lifecycle.ChangeStamp();
+    _buffer.resize(tile_size);
+
+    fprintf(stdout,"The biotope is stepped on its own thread, up to %i generations ahead of the window.\n",
+            (int) _frames.size());
+
+    _thread = std::thread(&FramePipeline::Run, this);
+}
+
+/** @fn FramePipeline::~FramePipeline()
+ *  @brief Destructor of the class FramePipeline. Stops the stepping thread.
+ */
+FramePipeline::~FramePipeline()
+{
+    _stop = true;
+
+    if (_thread.joinable())
+    {
+        _thread.join();
+    }
+}
+
+/** @fn FramePipeline::Run()
+ *  @brief Loop of the stepping thread: wait for a free frame, apply the edits, step and hand the frame over.
+ */
+void FramePipeline::Run()
+{
+    int index = 0;
+
+    while (!_stop)
+    {
+        // Backpressure: all frames are on their way to the window or waiting there.
+        if (!_free_frames.TryPop(index))
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+            while (!_stop && !_free_frames.TryPop(index))
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+
+            _step_wait_microseconds += std::chrono::duration_cast<std::chrono::microseconds>(
+                                           std::chrono::steady_clock::now() - start).count();
+
+            if (_stop)
+            {
+                break;
+            }
+        }
+
+        while (_edits.TryPop(_batch))
+        {
+            _lifecycle.SetCells(_batch);
+        }
+
+        {
+            GOL_PROFILE_SCOPE("LifeRules");
+            _lifecycle.LifeRules();
+        }
+
+        _generations_stepped++;
+
+        this->Capture(_frames[index]);
+        _ready_frames.TryPush(index);
+    }
+}
+
+/** @fn FramePipeline::Capture(struct_frame &frame)
+ *  @brief Packs the tiles, which changed since the last frame, including the edits.
+ */
+void FramePipeline::Capture(struct_frame &frame)
+{
+    GOL_PROFILE_SCOPE("FramePipeline::capture");
+
+    _lifecycle.ChangedTilesSince(_capture_stamp, frame.slots);
+    _capture_stamp = _lifecycle.ChangeStamp();
+
+    frame.generation = _lifecycle.Generation();
+    frame.rows.resize(frame.slots.size() * tile_size);
+
+    for (size_t i = 0; i < frame.slots.size(); i++)
+    {
+        memcpy(&frame.rows[i * tile_size], _lifecycle.TileRows(frame.slots[i], _buffer.data()),
+               tile_size * sizeof(uint64_t));
+    }
+
+    // The ages of the changed tiles only, the view lets the others grow older on its own.
+    if (_lifecycle.CellAgesEnabled())
+    {
+        frame.ages.resize(frame.slots.size() * tile_size * tile_size);
+
+        for (size_t i = 0; i < frame.slots.size(); i++)
+        {
+            _lifecycle.TileAges(frame.slots[i], &frame.ages[i * tile_size * tile_size]);
+        }
+    }
+}
+
+/** @fn FramePipeline::NextFrame()
+ *  @brief Brings the view to the oldest generation, which the window did not show yet.
+ */
+bool FramePipeline::NextFrame()
+{
+    int index = 0;
+
+    if (!_ready_frames.TryPop(index))
+    {
+        _frames_missed++;
+        return false;
+    }
+
+    struct_frame &frame = _frames[index];
+
+    {
+        GOL_PROFILE_SCOPE("FramePipeline::copy");
+        _view.CopyTiles(frame.slots, frame.rows.data(), frame.generation,
+                        frame.ages.empty() ? nullptr : frame.ages.data());
+    }
+
+    _free_frames.TryPush(index);
+    _frames_shown++;
+
+    return true;
+}
+
+/** @fn FramePipeline::SubmitEdits(std::vector<struct_cell_change> &&changes)
+ *  @brief Sends a batch of edits to the stepping thread. They take effect with the next generation.
+ */
+void FramePipeline::SubmitEdits(std::vector<struct_cell_change> &&changes)
+{
+    _pending_edits.insert(_pending_edits.end(), changes.begin(), changes.end());
+
+    if (!_pending_edits.empty() && _edits.TryPush(std::move(_pending_edits)))
+    {
+        _pending_edits.clear();
+    }
+}
+
+void FramePipeline::Report() const
+{
+    fprintf(stdout,"\nFrame pipeline: %lu generations stepped, %lu shown. The stepping waited %.1f s for the window, "
+            "the window %lu times for a generation.\n", (unsigned long) _generations_stepped.load(),
+            (unsigned long) _frames_shown, _step_wait_microseconds.load() / 1e6, (unsigned long) _frames_missed);
+}
+
+}
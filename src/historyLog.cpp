@@ -0,0 +1,414 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    historyLog.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Compressed log of all generations and its replay.
+ *
+ * This program part appends the key frames and deltas to the log and decodes them again for the replay.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <errno.h>
+#include <string.h>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "deltaCodec.hpp"
+#include "historyLog.hpp"
+#include "lifeCycle.hpp"
+#include "profiler.hpp"
+
+
+namespace GameOfLife
+{
+/** @fn HistoryRecorder::HistoryRecorder(std::string path, const LifeCycle &lifecycle, int key_frame_interval)
+ *  @brief Constructor of the class HistoryRecorder.
+ *
+ *  An existing log with the same path is overwritten.
+ */
+HistoryRecorder::HistoryRecorder(std::string path, const LifeCycle &lifecycle, int key_frame_interval)
+{
+    this->_path = path;
+    this->_key_frame_interval = key_frame_interval < 1 ? 1 : key_frame_interval;
+    this->_offset = 0;
+    this->_recorded = false;
+    this->_generation = 0;
+    this->_key_frame_generation = 0;
+    this->_stamp = 0;
+    this->_records = 0;
+
+    _file = fopen(path.c_str(), "wb");
+    _index = fopen((path + ".index").c_str(), "wb");
+
+    if (_file == nullptr || _index == nullptr)
+    {
+        fprintf(stdout,"Cannot create the history log %s: %s\n", path.c_str(), strerror(errno));
+
+        if (_file != nullptr) fclose(_file);
+        if (_index != nullptr) fclose(_index);
+        _file = nullptr;
+        _index = nullptr;
+        return;
+    }
+
+    struct_history_header header = {};
+    memcpy(header.magic, history_magic, sizeof header.magic);
+    header.rows = lifecycle.Rows();
+    header.columns = lifecycle.Columns();
+    header.key_frame_interval = _key_frame_interval;
+
+    fwrite(&header, sizeof header, 1, _file);
+    _offset = sizeof header;
+
+    _shadow.assign(lifecycle.tiles.size() * tile_size, 0);
+
+    fprintf(stdout,"Every generation is recorded into %s (key frame every %u generations).\n", path.c_str(),
+            _key_frame_interval);
+}
+
+/** @fn HistoryRecorder::~HistoryRecorder()
+ *  @brief Destructor of the class HistoryRecorder.
+ *
+ *  This functions closes the log and reports its size.
+ */
+HistoryRecorder::~HistoryRecorder()
+{
+    if (_file == nullptr)
+    {
+        return;
+    }
+
+    fclose(_file);
+    fclose(_index);
+
+    fprintf(stdout,"\nThe history log %s contains %lu records in %.3f MB.\n", _path.c_str(), (unsigned long) _records,
+            (_offset + _records * sizeof(struct_history_index)) / 1e6);
+}
+
+void HistoryRecorder::AppendTile(const LifeCycle &lifecycle, int slot, const uint64_t *rows)
+{
+    int32_t position[2] = {lifecycle.tiles[slot].tile_row, lifecycle.tiles[slot].tile_column};
+
+    size_t offset = _record.size();
+    _record.resize(offset + sizeof position + sizeof(uint32_t));
+    memcpy(&_record[offset], position, sizeof position);
+
+    EncodeTileRows(rows, _record);
+
+    uint32_t code_length = _record.size() - offset - sizeof position - sizeof(uint32_t);
+    memcpy(&_record[offset + sizeof position], &code_length, sizeof code_length);
+}
+
+/** @fn HistoryRecorder::Record(const LifeCycle &lifecycle)
+ *  @brief Appends the current generation to the log.
+ *
+ *  Nothing is written, if neither the generation nor any tile changed since the last record.
+ */
+void HistoryRecorder::Record(const LifeCycle &lifecycle)
+{
+    if (_file == nullptr)
+    {
+        return;
+    }
+
+    GOL_PROFILE_SCOPE("HistoryRecorder::Record");
+
+    lifecycle.ChangedTilesSince(_stamp, _slots);
+
+    if (_recorded && _slots.empty() && lifecycle.Generation() == _generation)
+    {
+        return;
+    }
+
+    bool key_frame = !_recorded || lifecycle.Generation() - _key_frame_generation >= _key_frame_interval;
+
+    struct_history_record record = {lifecycle.Generation(), lifecycle.Population(), 0, key_frame ? 1u : 0u, 0};
+    uint64_t delta[tile_size];
+
+    _record.clear();
+
+    // The shadow has to follow every changed tile, also in a key frame.
+    for (int slot : _slots)
+    {
+        uint64_t buffer[tile_size];
+        const uint64_t *rows = lifecycle.TileRows(slot, buffer);
+        uint64_t *shadow = &_shadow[(size_t) slot * tile_size];
+        uint64_t any = 0;
+
+        for (int r = 0; r < tile_size; r++)
+        {
+            delta[r] = rows[r] ^ shadow[r];
+            shadow[r] = rows[r];
+            any |= delta[r];
+        }
+
+        if (!key_frame && any != 0)
+        {
+            this->AppendTile(lifecycle, slot, delta);
+            record.tiles++;
+        }
+    }
+
+    if (key_frame)
+    {
+        for (int slot = 0; slot < lifecycle.tiles.size(); slot++)
+        {
+            const uint64_t *shadow = &_shadow[(size_t) slot * tile_size];
+            uint64_t any = 0;
+
+            for (int r = 0; r < tile_size; r++)
+            {
+                any |= shadow[r];
+            }
+
+            if (any != 0)
+            {
+                this->AppendTile(lifecycle, slot, shadow);
+                record.tiles++;
+            }
+        }
+
+        _key_frame_generation = lifecycle.Generation();
+    }
+
+    record.bytes = _record.size();
+
+    struct_history_index index = {record.generation, _offset, record.key_frame, 0};
+
+    fwrite(&record, sizeof record, 1, _file);
+    fwrite(_record.data(), 1, _record.size(), _file);
+    fwrite(&index, sizeof index, 1, _index);
+
+    _offset += sizeof record + _record.size();
+    _records++;
+    _recorded = true;
+    _generation = lifecycle.Generation();
+    _stamp = lifecycle.ChangeStamp();
+}
+
+/** @fn HistoryReplay::HistoryReplay(std::string path)
+ *  @brief Constructor of the class HistoryReplay.
+ *
+ *  Reads the seek index. Without a usable index, the log is scanned once.
+ */
+HistoryReplay::HistoryReplay(std::string path)
+{
+    this->_tiles_x = 0;
+    this->_tiles_y = 0;
+    this->_position = 0;
+    this->_valid = false;
+
+    memset(&_header, 0, sizeof _header);
+
+    _file = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    struct stat status;
+
+    if (_file < 0 || fstat(_file, &status) != 0 || pread(_file, &_header, sizeof _header, 0) != sizeof _header ||
+        memcmp(_header.magic, history_magic, sizeof _header.magic) != 0 || _header.rows <= 0 || _header.columns <= 0)
+    {
+        fprintf(stdout,"Cannot read the history log %s.\n", path.c_str());
+
+        if (_file >= 0) close(_file);
+        _file = -1;
+        return;
+    }
+
+    uint64_t file_size = status.st_size;
+
+    FILE *index = fopen((path + ".index").c_str(), "rb");
+
+    if (index != nullptr)
+    {
+        struct_history_index entry;
+
+        while (fread(&entry, sizeof entry, 1, index) == 1)
+        {
+            _records.push_back(entry);
+        }
+
+        fclose(index);
+    }
+
+    // Records behind the end of the log come from an interrupted write.
+    while (!_records.empty() && _records.back().offset + sizeof(struct_history_record) > file_size)
+    {
+        _records.pop_back();
+    }
+
+    if (index == nullptr || _records.empty())
+    {
+        this->ScanRecords(file_size);
+    }
+
+    _tiles_x = (_header.columns + tile_size - 1) / tile_size;
+    _tiles_y = (_header.rows + tile_size - 1) / tile_size;
+    _board.assign((size_t) _tiles_x * _tiles_y * tile_size, 0);
+
+    if (_records.empty() || !_records.front().key_frame)
+    {
+        fprintf(stdout,"The history log %s contains no key frame.\n", path.c_str());
+        _records.clear();
+        return;
+    }
+
+    fprintf(stdout,"The history log %s contains the generations %lu to %lu in %lu records.\n", path.c_str(),
+            (unsigned long) _records.front().generation, (unsigned long) _records.back().generation,
+            (unsigned long) _records.size());
+}
+
+/** @fn HistoryReplay::~HistoryReplay()
+ *  @brief Destructor of the class HistoryReplay.
+ *
+ */
+HistoryReplay::~HistoryReplay()
+{
+    if (_file >= 0)
+    {
+        close(_file);
+    }
+}
+
+/** @fn HistoryReplay::ScanRecords(uint64_t file_size)
+ *  @brief Builds the seek index from the record headers.
+ */
+void HistoryReplay::ScanRecords(uint64_t file_size)
+{
+    _records.clear();
+
+    uint64_t offset = sizeof(struct_history_header);
+    struct_history_record record;
+
+    while (offset + sizeof record <= file_size && pread(_file, &record, sizeof record, offset) == sizeof record &&
+           offset + sizeof record + record.bytes <= file_size)
+    {
+        _records.push_back({record.generation, offset, record.key_frame, 0});
+        offset += sizeof record + record.bytes;
+    }
+}
+
+/** @fn HistoryReplay::ApplyRecord(size_t record)
+ *  @brief Reads one record and applies it to the decoded biotope.
+ */
+bool HistoryReplay::ApplyRecord(size_t record)
+{
+    struct_history_record header;
+
+    if (pread(_file, &header, sizeof header, _records[record].offset) != sizeof header)
+    {
+        return false;
+    }
+
+    _record.resize(header.bytes);
+
+    if (pread(_file, _record.data(), header.bytes, _records[record].offset + sizeof header) != (ssize_t) header.bytes)
+    {
+        return false;
+    }
+
+    if (header.key_frame)
+    {
+        std::fill(_board.begin(), _board.end(), 0);
+    }
+
+    uint64_t rows[tile_size];
+    size_t position = 0;
+
+    for (uint32_t i = 0; i < header.tiles; i++)
+    {
+        int32_t tile[2];
+        uint32_t code_length;
+
+        if (position + sizeof tile + sizeof code_length > _record.size())
+        {
+            return false;
+        }
+
+        memcpy(tile, &_record[position], sizeof tile);
+        memcpy(&code_length, &_record[position + sizeof tile], sizeof code_length);
+        position += sizeof tile + sizeof code_length;
+
+        if (tile[0] < 0 || tile[0] >= _tiles_y || tile[1] < 0 || tile[1] >= _tiles_x ||
+            DecodeTileRows(&_record[position], std::min<size_t>(code_length, _record.size() - position), rows) !=
+            code_length)
+        {
+            return false;
+        }
+
+        position += code_length;
+
+        uint64_t *board = &_board[((size_t) tile[0] * _tiles_x + tile[1]) * tile_size];
+
+        for (int r = 0; r < tile_size; r++)
+        {
+            board[r] ^= rows[r];
+        }
+    }
+
+    return true;
+}
+
+/** @fn HistoryReplay::SeekRecord(size_t record, LifeCycle &lifecycle)
+ *  @brief Loads the biotope of the given record into the life cycle.
+ */
+bool HistoryReplay::SeekRecord(size_t record, LifeCycle &lifecycle)
+{
+    if (!this->IsOpen() || record >= _records.size())
+    {
+        return false;
+    }
+
+    GOL_PROFILE_SCOPE("HistoryReplay::SeekRecord");
+
+    size_t key_frame = record;
+
+    while (!_records[key_frame].key_frame)
+    {
+        key_frame--;
+    }
+
+    // Going forward within the same key frame needs only the deltas behind the current position.
+    size_t first = _valid && _position >= key_frame && _position <= record ? _position + 1 : key_frame;
+
+    for (size_t i = first; i <= record; i++)
+    {
+        if (!this->ApplyRecord(i))
+        {
+            fprintf(stdout,"\nThe record %lu of the history log is broken.\n", (unsigned long) i);
+            _valid = false;
+            return false;
+        }
+    }
+
+    _position = record;
+    _valid = true;
+
+    lifecycle.LoadTiles(_board, _records[record].generation);
+
+    return true;
+}
+
+/** @fn HistoryReplay::Seek(uint64_t generation, LifeCycle &lifecycle)
+ *  @brief Loads the last recorded generation, which is not behind the given one.
+ */
+bool HistoryReplay::Seek(uint64_t generation, LifeCycle &lifecycle)
+{
+    auto it = std::upper_bound(_records.begin(), _records.end(), generation,
+                               [](uint64_t value, const struct_history_index &entry)
+                               { return value < entry.generation; });
+
+    size_t record = it == _records.begin() ? 0 : (it - _records.begin()) - 1;
+
+    return this->SeekRecord(record, lifecycle);
+}
+
+}
@@ -16,8 +16,22 @@
 // --------------------------------------------------------------------------------------------------------------------
 
 #include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <algorithm>
 #include <unordered_map>
+#include "census.hpp"
+#include "deltaCodec.hpp"
+#include "edgeMonitor.hpp"
+#include "engineSelector.hpp"
+#include "historyLog.hpp"
 #include "lifeCycle.hpp"
+#include "lookupKernel.hpp"
+#include "numaTopology.hpp"
+#include "profiler.hpp"
+#include "sharedState.hpp"
+#include "workerPool.hpp"
 #include <stdlib.h>
 #include <time.h>
 
@@ -29,16 +43,45 @@ namespace GameOfLife
  *
  */
 LifeCycle::LifeCycle(int rows, int columns, int number_of_elements, std::string mode, std::string pattern, 
-                     int live_rate)
+                     int live_rate, bool verbose) : _cycle_detector(64)
 {
     // Initialize variables
+    this->_verbose = verbose;                       // Print the settings and events. Off for batch runs.
     this->_rows = rows;
     this->_columns= columns;
     this->_elements = number_of_elements;
     this->_live_rate = live_rate;                   // % of living individuals. Only usable with random placement mode.
     
     mode_enum = order_mode::random;
-    LifeCycle::individuals.resize(number_of_elements);
+    step_mode_enum = step_mode::active_tiles;
+    kernel_enum = step_kernel::bitwise;
+    cycle_action_enum = cycle_action::keep_running;
+
+    this->tiles_x = 0;
+    this->tiles_y = 0;
+    this->_population = 0;
+    this->_generation = 0;
+    this->_max_generations = 0;
+    this->_board_hash = 0;
+    this->_change_stamp = 0;
+    this->_commit_stamp = 0;
+    this->_halted = false;
+    this->_outer_halo_enabled = false;
+    this->_sample_generations = 0;
+    this->_sample_stepped = 0;
+    this->_sample_changed = 0;
+    this->_census_interval = 0;
+    this->_census_cycle = false;
+    this->_cold_generations = 0;
+    this->_cold_sweep_countdown = 0;
+    this->_cold_tile_count = 0;
+    this->_cold_sweep_stamp = 0;
+    this->_cold_bytes = 0;
+    this->_cold_hash[0] = this->_cold_hash[1] = 0;
+    this->_cold_population[0] = this->_cold_population[1] = 0;
+    this->_cold_list_dirty = false;
+    this->_events_valid = false;
+    this->_rule = conway_rule;
     
     // initialize random seed
     seed = time(NULL);
@@ -52,7 +95,7 @@ LifeCycle::LifeCycle(int rows, int columns, int number_of_elements, std::string
     
     if (it != table.end()) 
     {
-        fprintf(stdout,"Population of the biotope will use the mode: %s.\n", mode.c_str());
+        if (_verbose) fprintf(stdout,"Population of the biotope will use the mode: %s.\n", mode.c_str());
         mode_enum = it->second;
     } 
     else 
@@ -75,6 +118,8 @@ LifeCycle::~LifeCycle()
 
 void LifeCycle::Init(GameOfLife::order_mode mode)
 {
+    this->TileConfigurator();
+
     switch(mode)
     {
         case order_mode::random :
@@ -92,191 +137,2315 @@ void LifeCycle::Init(GameOfLife::order_mode mode)
     }
 }
 
-void LifeCycle::RandomPatternGenerator()
+/** @fn MortonCode(uint32_t x, uint32_t y)
+ *  @brief Interleaves the bits of x and y (x in the even bits).
+ */
+static uint64_t MortonCode(uint32_t x, uint32_t y)
 {
-    // Initialize random seed
-    srand (seed);
-    
-    for (int i = 0; i < LifeCycle::individuals.size(); i++)
-    {    
-        // Decision of life and death. If the random number is bigger than a certain number, the individual will live.
-        // Otherwise, it will be dead.
-        if (rand() % 101 < this->_live_rate)
+    uint64_t code = 0;
+
+    for (int bit = 0; bit < 32; bit++)
+    {
+        code |= (uint64_t) ((x >> bit) & 1) << (2 * bit);
+        code |= (uint64_t) ((y >> bit) & 1) << (2 * bit + 1);
+    }
+
+    return code;
+}
+
+/** @fn LifeCycle::TileConfigurator()
+ *  @brief Splits the biotope into tiles and places them along the Z-order curve.
+ *
+ *  The tiles at the right and lower border can be partly outside of the board. These cells are masked out and stay
+ *  dead forever.
+ */
+void LifeCycle::TileConfigurator()
+{
+    tiles_x = (_columns + tile_size - 1) / tile_size;
+    tiles_y = (_rows + tile_size - 1) / tile_size;
+
+    int slots = tiles_x * tiles_y;
+
+    // Sort the tiles along the Morton curve. The board is not a power of two, so the codes have gaps.
+    std::vector<std::pair<uint64_t, int>> order(slots);
+
+    for (int ty = 0; ty < tiles_y; ty++)
+    {
+        for (int tx = 0; tx < tiles_x; tx++)
         {
-            if(!LifeCycle::individuals.at(i).alive)
-            {
-                LifeCycle::individuals.at(i).change = true;
-                LifeCycle::individuals.at(i).alive = true;
-            }
+            order[ty * tiles_x + tx] = {MortonCode(tx, ty), ty * tiles_x + tx};
         }
-        else
+    }
+
+    std::sort(order.begin(), order.end());
+
+    _slot_of_tile.assign(slots, -1);
+
+    for (int slot = 0; slot < slots; slot++)
+    {
+        _slot_of_tile[order[slot].second] = slot;
+    }
+
+    // Neighbour offsets in the same order as in struct_tile.
+    static int constexpr offsets[8][2] = {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}};
+
+    tiles.resize(slots);
+    _on_boundary.assign(slots, 0);
+
+    for (int slot = 0; slot < slots; slot++)
+    {
+        struct_tile &tile = tiles[slot];
+
+        tile.tile_row = order[slot].second / tiles_x;
+        tile.tile_column = order[slot].second % tiles_x;
+
+        for (int n = 0; n < 8; n++)
+        {
+            int ty = tile.tile_row + offsets[n][0];
+            int tx = tile.tile_column + offsets[n][1];
+
+            tile.neighbours[n] = (ty < 0 || ty >= tiles_y || tx < 0 || tx >= tiles_x) ? -1 : this->TileSlot(ty, tx);
+            _on_boundary[slot] |= tile.neighbours[n] < 0;
+        }
+
+        int valid_columns = std::min(tile_size, _columns - tile.tile_column * tile_size);
+        tile.valid_rows = std::min(tile_size, _rows - tile.tile_row * tile_size);
+        tile.column_mask = valid_columns == tile_size ? ~0ULL : (1ULL << valid_columns) - 1;
+    }
+
+    _cells.assign((size_t) slots * tile_stride, 0);
+    _front.assign(slots, 0);
+    _active.assign(slots, 0);
+    _tile_changed.assign(slots, 0);
+    _tile_population.assign(slots, 0);
+    _tile_hash.assign(slots, 0);
+    _tile_new_hash.assign(slots, 0);
+    _tile_stamp.assign(slots, 0);
+    _touched.assign(slots, 0);
+    _cold_of_slot.assign(slots, -1);
+    _tile_aperiodic.assign(slots, 0);
+    _tile_stepped.assign(slots, 0);
+    _tile_aperiodic_stamp.assign(slots, 0);
+
+    // The lists of tiles never get longer than the board, so they never have to grow while stepping.
+    changed_tiles.reserve(slots);
+    _active_slots.reserve(slots);
+    _interior_slots.reserve(slots);
+    _boundary_slots.reserve(slots);
+    _touched_slots.reserve(slots);
+
+    if (_verbose)
+    {
+        fprintf(stdout,"The biotope is stored in %i x %i tiles of %i x %i individuals.\n", tiles_y, tiles_x, tile_size,
+                tile_size);
+    }
+}
+
+/** @fn LifeCycle::SetThreads(int threads, std::string pinning)
+ *  @brief Sets the number of threads, which step the tiles.
+ *
+ *  With pinned threads every worker steps always the same tiles. The tiles are moved into memory, which the worker
+ *  touches first, so they end up on its NUMA node.
+ */
+void LifeCycle::SetThreads(int threads, std::string pinning)
+{
+    if (threads <= 1)
+    {
+        _pool.reset();
+        return;
+    }
+
+    NumaTopology topology;
+    std::vector<int> cpus = topology.PinOrder(pinning, threads);
+
+    _pool.reset(new WorkerPool(threads, cpus));
+
+    if (_verbose)
+    {
+        fprintf(stdout,"The tiles are stepped by %i threads.\n", threads);
+        fprintf(stdout,"Topology: %s.\n", topology.Describe().c_str());
+
+        if (_pool->Pinned())
         {
-            if(LifeCycle::individuals.at(i).alive)
+            std::string pins;
+
+            for (int worker = 0; worker < threads; worker++)
             {
-                LifeCycle::individuals.at(i).change = true;
-                LifeCycle::individuals.at(i).alive = false;
+                pins += " " + std::to_string(worker) + ":" + std::to_string(cpus[worker]) + "/" +
+                        std::to_string(topology.NodeOfCpu(cpus[worker]));
             }
-        }   
+
+            fprintf(stdout,"The threads are pinned %s (worker:CPU/node):%s\n", pinning.c_str(), pins.c_str());
+        }
+    }
+
+    if (_pool->Pinned())
+    {
+        this->PlaceTiles();
     }
-    
-    seed = rand();
 }
 
-void LifeCycle::SinglePatternGenerator()
+/** @fn LifeCycle::PlaceTiles()
+ *  @brief Copies the tiles into new memory, which is touched first by the worker, which steps them.
+ */
+void LifeCycle::PlaceTiles()
 {
+    board_vector<uint64_t> cells;
+    cells.resize(_cells.size());
 
+    _pool->ParallelForStatic(tiles.size(), [this, &cells](int begin, int end, int worker)
+    {
+        size_t first = (size_t) begin * tile_stride, last = (size_t) end * tile_stride;
+
+        std::copy(_cells.begin() + first, _cells.begin() + last, cells.begin() + first);
+    });
+
+    _cells.swap(cells);
 }
 
-void LifeCycle::EmptyPatternGenerator()
+/** @fn LifeCycle::SetStepMode(std::string mode)
+ *  @brief Chooses between stepping every tile or only the active ones.
+ *
+ *  The mode "adaptive" starts with the active tiles and changes the mode with the measured state of the biotope.
+ */
+void LifeCycle::SetStepMode(std::string mode)
 {
-    for (int i = 0; i < LifeCycle::individuals.size(); i++)
-    {    
-        LifeCycle::individuals.at(i).change = false;
-        LifeCycle::individuals.at(i).alive = false;  
+    static std::unordered_map<std::string, step_mode> const table =
+        { {"full_sweep", step_mode::full_sweep},
+        {"active_tiles", step_mode::active_tiles},
+        {"events", step_mode::events},
+        {"adaptive", step_mode::active_tiles} };
+
+    auto it = table.find(mode);
+
+    if (it != table.end())
+    {
+        if (_verbose) fprintf(stdout,"The life cycle will use the step mode: %s.\n", mode.c_str());
+        step_mode_enum = it->second;
+    }
+    else
+    {
+        step_mode_enum = step_mode::active_tiles;
+        fprintf(stdout,"Cannot find the step mode: %s. The program will continue with active_tiles.\n", mode.c_str());
+    }
+
+    if (mode == "adaptive")
+    {
+        this->Selector().SetAdaptive(true);
+    }
+    else if (_selector)
+    {
+        _selector->SetAdaptive(false);
+    }
+
+    if (step_mode_enum == step_mode::events)
+    {
+        this->SizeEvents();
     }
+
+    // Start with every tile, the next generations will sort out the inactive ones.
+    this->MarkAllChanged();
 }
 
-void LifeCycle::LifeRules()
+/** @fn LifeCycle::SetStats(int interval, std::string stats_file)
+ *  @brief Sets the number of generations between two samples of the density and churn.
+ *
+ *  The samples drive the adaptive step mode. With a file name, they are written into this CSV file as well.
+ */
+void LifeCycle::SetStats(int interval, std::string stats_file)
 {
-    int one, two, three, four, five, six, seven, eight;
-    
-    int living_neighbours;
-    
-    // Make a copy of the structure.
-    std::vector<struct_individuals> copy_of_individuals(LifeCycle::individuals);
+    this->Selector().SetInterval(interval);
 
-    // Iterate through all the individuals.
-    for (int i = 0; i < LifeCycle::individuals.size(); i++)
+    if (!stats_file.empty())
     {
-        living_neighbours = 0;
-    
-        // Check all 8 neighbours.
-        // Here the control pattern:
-        //
-        //   1   2   3
-        //   4   X   5
-        //   6   7   8
-        //
-        // ---- 1 ----
-        // If the individual is not located at the upper and left border, there is a neighbour.
-        if (i > (_columns - 1) && i % _columns != 0)
-        {
-            one = i - _columns - 1;
-                    
-            if (LifeCycle::individuals.at(one).alive)
-            {
-                living_neighbours++;
-            }
-        }
-      
-        // ---- 2 ----
-        // If the individual is not located at the upper border, there is a neighbour.
-        if (i > (_columns - 1))
-        {
-            two = i - _columns;
-                    
-            if (LifeCycle::individuals.at(two).alive)
-            {
-                living_neighbours++;               
-            }
-        }
-        
-        // ---- 3 ----
-        // If the individual is not located at the upper and right border, there is a neighbour.
-        if (i > (_columns - 1) && (i + 1) % _columns != 0)
+        _selector->OpenStats(stats_file);
+    }
+}
+
+EngineSelector &LifeCycle::Selector()
+{
+    if (!_selector)
+    {
+        _selector.reset(new EngineSelector(_verbose));
+        _sample_start = std::chrono::steady_clock::now();
+    }
+
+    return *_selector;
+}
+
+/** @fn LifeCycle::SetKernel(std::string kernel)
+ *  @brief Chooses the function, which calculates the next generation of a tile.
+ */
+void LifeCycle::SetKernel(std::string kernel)
+{
+    static std::unordered_map<std::string, step_kernel> const table =
+        { {"bitwise", step_kernel::bitwise},
+        {"lookup_table", step_kernel::lookup_table} };
+
+    auto it = table.find(kernel);
+
+    if (it != table.end())
+    {
+        if (_verbose) fprintf(stdout,"The tiles will be stepped with the kernel: %s.\n", kernel.c_str());
+        kernel_enum = it->second;
+    }
+    else
+    {
+        kernel_enum = step_kernel::bitwise;
+        fprintf(stdout,"Cannot find the kernel: %s. The program will continue with bitwise.\n", kernel.c_str());
+    }
+}
+
+/** @fn LifeCycle::SetRule(std::string rule)
+ *  @brief Chooses the rule of life, e.g. B3/S23 (Conway) or B36/S23 (HighLife).
+ */
+void LifeCycle::SetRule(std::string rule)
+{
+    if (ParseRule(rule, _rule))
+    {
+        if (_verbose && _rule != conway_rule)
         {
-            three = i - _columns + 1;
-                    
-            if (LifeCycle::individuals.at(three).alive)
-            {
-                living_neighbours++;
-            }
+            fprintf(stdout,"The biotope lives by the rule: %s.\n", RuleName(_rule).c_str());
         }
-        
-        // ---- 4 ----
-        // If the individual is not located at the left border, there is a neighbour.
-        if (i > 0 && i % _columns != 0)
+    }
+    else
+    {
+        _rule = conway_rule;
+        fprintf(stdout,"Cannot read the rule: %s. The program will continue with B3/S23.\n", rule.c_str());
+    }
+}
+
+/** @fn LifeCycle::SetCycleDetection(std::string action, int window)
+ *  @brief Chooses what happens, when the biotope repeats itself within the last "window" generations.
+ */
+void LifeCycle::SetCycleDetection(std::string action, int window)
+{
+    static std::unordered_map<std::string, cycle_action> const table =
+        { {"continue", cycle_action::keep_running},
+        {"halt", cycle_action::halt},
+        {"fast_forward", cycle_action::fast_forward} };
+
+    auto it = table.find(action);
+
+    if (it != table.end())
+    {
+        if (_verbose) fprintf(stdout,"On a detected cycle the life cycle will %s.\n", action.c_str());
+        cycle_action_enum = it->second;
+    }
+    else
+    {
+        cycle_action_enum = cycle_action::keep_running;
+        fprintf(stdout,"Cannot find the cycle action: %s. The program will continue.\n", action.c_str());
+    }
+
+    _cycle_detector = CycleDetector(window);
+    _cycle_detector.Update(_generation, _board_hash);
+}
+
+/** @fn LifeCycle::EnableSharedExport(std::string name, int slots)
+ *  @brief Publishes every generation into a ring of frames in the POSIX shared memory with the given name.
+ */
+void LifeCycle::EnableSharedExport(std::string name, int slots)
+{
+    _exporter.reset(new SharedStateExporter(name, slots, *this));
+
+    if (!_exporter->IsOpen())
+    {
+        _exporter.reset();
+        return;
+    }
+
+    // The first frame contains every tile.
+    this->MarkAllChanged();
+}
+
+/** @fn LifeCycle::EnableHistory(std::string path, int key_frame_interval)
+ *  @brief Records every generation into a compressed log, which can be replayed later.
+ */
+void LifeCycle::EnableHistory(std::string path, int key_frame_interval)
+{
+    _history.reset(new HistoryRecorder(path, *this, key_frame_interval));
+
+    if (!_history->IsOpen())
+    {
+        _history.reset();
+        return;
+    }
+
+    _history->Record(*this);
+}
+
+/** @fn LifeCycle::EnableCensus(int interval, std::string census_file)
+ *  @brief Takes a census of the objects every interval generations and when the biotope starts to repeat itself.
+ */
+void LifeCycle::EnableCensus(int interval, std::string census_file)
+{
+    _census.reset(new ObjectCensus(_verbose));
+    _census_interval = interval;
+    _census_cycle = _cycle_detector.cycle.detected;
+
+    if (!census_file.empty())
+    {
+        _census->OpenFile(census_file);
+    }
+
+    if (_verbose && interval > 0)
+    {
+        fprintf(stdout,"Every %i generations the objects of the biotope are counted.\n", interval);
+    }
+}
+
+/** @fn LifeCycle::TakeCensus()
+ *  @brief Counts the objects of the current generation with the worker threads of the life cycle.
+ */
+const ObjectCensus &LifeCycle::TakeCensus()
+{
+    if (!_census)
+    {
+        _census.reset(new ObjectCensus(_verbose));
+    }
+
+    {
+        GOL_PROFILE_SCOPE("LifeRules::census");
+        _census->Take(*this, _pool.get());
+    }
+
+    _census->Write();
+
+    return *_census;
+}
+
+/** @fn LifeCycle::EnableEdgeMonitor(int margin)
+ *  @brief Removes the spaceships, which leave the biotope, and counts them.
+ */
+void LifeCycle::EnableEdgeMonitor(int margin)
+{
+    _edge_monitor.reset(new EdgeMonitor(margin, _rows, _columns));
+
+    if (_verbose) fprintf(stdout,"Spaceships, which leave the biotope, are removed at the border.\n");
+}
+
+/** @fn LifeCycle::EnableColdTiles(int generations)
+ *  @brief Compresses the tiles, which did not change for the given number of generations (0: never).
+ */
+void LifeCycle::EnableColdTiles(int generations)
+{
+    _cold_generations = std::max(generations, 0);
+    _cold_sweep_countdown = _cold_generations;
+    _cold_sweep_stamp = _change_stamp;
+
+    for (int slot = 0; _cold_generations == 0 && _cold_tile_count > 0 && slot < tiles.size(); slot++)
+    {
+        if (_cold_of_slot[slot] >= 0)
         {
-            four = i - 1;
-                        
-            if (LifeCycle::individuals.at(four).alive)
-            {
-                living_neighbours++; 
-            }
+            this->ThawTile(slot);
         }
-        
-        // ---- 5 ----
-        // If the individual is not located at the right border, there is a neighbour.
-        if ((i + 1) % _columns != 0)
+    }
+
+    if (_verbose && _cold_generations > 0)
+    {
+        fprintf(stdout,"Tiles, which do not change for %i generations, are compressed.\n", _cold_generations);
+    }
+}
+
+/** @fn LifeCycle::EnableCellAges(bool enable)
+ *  @brief Keeps the age of every individual from now on. The individuals, which live already, start with age 1.
+ */
+void LifeCycle::EnableCellAges(bool enable)
+{
+    if (!enable)
+    {
+        _ages = board_vector<uint8_t>();
+        _age_generation.clear();
+        return;
+    }
+
+    _ages.assign(tiles.size() * tile_size * tile_size, 1);
+    _age_generation.assign(tiles.size(), _generation);
+
+    if (_verbose)
+    {
+        fprintf(stdout,"The age of every individual is kept, up to %i generations.\n", max_cell_age);
+    }
+}
+
+/** @fn LifeCycle::EnableOuterHalo()
+ *  @brief Takes the individuals around the board from the outer halo instead of treating them as dead.
+ */
+void LifeCycle::EnableOuterHalo()
+{
+    _outer_halo.north.assign(tiles_x, 0);
+    _outer_halo.south.assign(tiles_x, 0);
+    _outer_halo.west.assign(tiles_y, 0);
+    _outer_halo.east.assign(tiles_y, 0);
+    _outer_halo.corners = 0;
+    _outer_halo_enabled = true;
+}
+
+/** @fn LifeCycle::LoadTiles(const std::vector<uint64_t> &rows, uint64_t generation)
+ *  @brief Replaces the biotope, e.g. by a recorded generation.
+ */
+void LifeCycle::LoadTiles(const std::vector<uint64_t> &rows, uint64_t generation)
+{
+    if (rows.size() != tiles.size() * tile_size)
+    {
+        fprintf(stdout,"The loaded biotope does not have the size of the board.\n");
+        return;
+    }
+
+    this->DropColdTiles();
+
+    for (int slot = 0; slot < tiles.size(); slot++)
+    {
+        const struct_tile &tile = tiles[slot];
+        const uint64_t *source = &rows[((size_t) tile.tile_row * tiles_x + tile.tile_column) * tile_size];
+        uint64_t *destination = this->FrontRows(slot);
+
+        for (int r = 0; r < tile_size; r++)
         {
-            five = i + 1;
-                        
-            if (LifeCycle::individuals.at(five).alive)
-            {
-                living_neighbours++;
-            }
+            destination[r] = r < tile.valid_rows ? source[r] & tile.column_mask : 0;
         }
-        
-        // ---- 6 ----
-        // If the individual is not located at the lower and left border, there is a neighbour.
-        if (i < (_columns * (_rows - 1)) && i % _columns != 0)
+    }
+
+    _generation = generation;
+
+    this->MarkAllChanged();
+}
+
+/** @fn LifeCycle::CopyTiles(const std::vector<int> &slots, const uint64_t *rows, uint64_t generation)
+ *  @brief Copies the given tiles, e.g. from a life cycle, which is stepped on another thread.
+ */
+void LifeCycle::CopyTiles(const std::vector<int> &slots, const uint64_t *rows, uint64_t generation,
+                          const uint8_t *ages)
+{
+    changed_tiles.clear();
+    _commit_stamp = ++_change_stamp;
+
+    for (size_t i = 0; i < slots.size(); i++)
+    {
+        int slot = slots[i];
+
+        if (_cold_of_slot[slot] >= 0)
         {
-            six = i + _columns - 1;
-                        
-            if (LifeCycle::individuals.at(six).alive)
-            {
-                living_neighbours++;
-            }
+            this->ThawTile(slot);
         }
-        
-        // ---- 7 ----
-        // If the individual is not located at the lower border, there is a neighbour.
-        if (i < (_columns * (_rows - 1)))
+
+        const uint64_t *source = &rows[i * tile_size];
+        uint64_t *destination = this->FrontRows(slot);
+        int population = 0;
+
+        for (int r = 0; r < tile_size; r++)
         {
-            seven = i + _columns;
-                        
-            if (LifeCycle::individuals.at(seven).alive)
-            {
-                living_neighbours++;
-            }
+            destination[r] = source[r];
+            population += __builtin_popcountll(source[r]);
         }
-        
-        // ---- 8 ----
-        // If the individual is not located at the lower and right border, there is a neighbour.
-        if (i < (_columns * (_rows - 1)) && (i + 1) % _columns != 0)
+
+        _population += population - _tile_population[slot];
+        _tile_population[slot] = population;
+
+        if (ages && !_ages.empty())
         {
-            eight = i + _columns + 1;
-                        
-            if (LifeCycle::individuals.at(eight).alive)
-            {
-                living_neighbours++;
-            }
+            std::copy(&ages[i * tile_size * tile_size], &ages[(i + 1) * tile_size * tile_size],
+                      &_ages[(size_t) slot * tile_size * tile_size]);
+            _age_generation[slot] = generation;
         }
-        
-        // Here come the rules.
-    
-        // If a living cell has 2 or 3 living neighbours, the cell continues to live.
-        if (living_neighbours == 2 || living_neighbours == 3)
+
+        this->TouchTile(slot);
+    }
+
+    _generation = generation;
+}
+
+/** @fn ByteMasks(uint64_t bits, uint8_t *masks)
+ *  @brief One byte per bit: 0xFF for a set bit, 0 otherwise.
+ */
+static inline void ByteMasks(uint64_t bits, uint8_t *masks)
+{
+    // Byte b of the entry for the value v is 0xFF, if bit b of v is set.
+    static const struct struct_byte_masks
+    {
+        uint64_t entry[256];
+
+        struct_byte_masks()
         {
-            // If a dead individual has three living neighbours, the individual gets resurrected.
-            if (!LifeCycle::individuals.at(i).alive && living_neighbours == 3)
+            for (int value = 0; value < 256; value++)
             {
-                copy_of_individuals.at(i).change = true;
-                copy_of_individuals.at(i).alive = true;
+                entry[value] = 0;
+
+                for (int bit = 0; bit < 8; bit++)
+                {
+                    entry[value] |= (uint64_t) ((value >> bit) & 1) * (0xFFULL << (8 * bit));
+                }
             }
         }
-        else if (LifeCycle::individuals.at(i).alive)
-        {
-            copy_of_individuals.at(i).change = true;
-            copy_of_individuals.at(i).alive = false;
-        }
-        
-        copy_of_individuals.at(i).living_neighbours = living_neighbours;
+    } table;
+
+    for (int i = 0; i < 8; i++)
+    {
+        memcpy(&masks[8 * i], &table.entry[(bits >> (8 * i)) & 0xFF], sizeof(uint64_t));
+    }
+}
+
+/** @fn LifeCycle::CellAge(int row, int column)
+ *  @brief Generations, which the individual is alive, up to max_cell_age. 0 for a dead individual.
+ */
+uint8_t LifeCycle::CellAge(int row, int column) const
+{
+    int slot = this->TileSlot(row / tile_size, column / tile_size);
+
+    if (((this->TileRow(slot, row % tile_size) >> (column % tile_size)) & 1) == 0)
+    {
+        return 0;
+    }
+
+    if ((this->ColdTileFlips(slot, row % tile_size) >> (column % tile_size)) & 1)
+    {
+        return 1;
+    }
+
+    uint64_t age = _ages[((size_t) slot * tile_size + row % tile_size) * tile_size + column % tile_size];
+
+    return (uint8_t) std::max<uint64_t>(1, std::min<uint64_t>(age + _generation - _age_generation[slot],
+                                                              max_cell_age));
+}
+
+/** @fn LifeCycle::TileAges(int slot, uint8_t *ages)
+ *  @brief Ages of all individuals of the tile, tile_size x tile_size bytes row by row.
+ *
+ *  The individuals of a cold oscillator, which flip with the phase, are born again every second generation.
+ */
+void LifeCycle::TileAges(int slot, uint8_t *ages) const
+{
+    uint64_t buffer[tile_size], flips[tile_size] = {};
+    const uint64_t *rows = this->TileRows(slot, buffer);
+    const uint8_t *stored = &_ages[(size_t) slot * tile_size * tile_size];
+    uint8_t gap = (uint8_t) std::min<uint64_t>(_generation - _age_generation[slot], max_cell_age);
+
+    int cold = _cold_of_slot[slot];
+
+    if (cold >= 0 && _cold_tiles[cold].oscillating)
+    {
+        const struct_cold_tile &tile = _cold_tiles[cold];
+        DecodeTileRows(tile.code.data() + tile.split, tile.code.size() - tile.split, flips);
+    }
+
+    alignas(16) uint8_t living[tile_size], flipping[tile_size];
+
+    for (int r = 0; r < tile_size; r++)
+    {
+        if (rows[r] == 0)
+        {
+            memset(&ages[r * tile_size], 0, tile_size);
+            continue;
+        }
+
+        ByteMasks(rows[r], living);
+        ByteMasks(flips[r], flipping);
+
+        for (int c = 0; c < tile_size; c++)
+        {
+            uint8_t age = stored[r * tile_size + c] + gap;
+            age = age < gap ? max_cell_age : age;
+
+            ages[r * tile_size + c] = (((age | (age == 0)) & ~flipping[c]) | (1 & flipping[c])) & living[c];
+        }
+    }
+}
+
+/** @fn LifeCycle::UpdateAges(int slot, const uint64_t *current, const uint64_t *next)
+ *  @brief Ages of a changed tile after its step: births get age 1, survivors become older.
+ *
+ *  Only rows with living individuals are touched. An unchanged tile keeps its stored ages, see TileAges(). The bits
+ *  are widened to byte masks, so the loop over a row has no branches and runs in vector registers.
+ */
+void LifeCycle::UpdateAges(int slot, const uint64_t *current, const uint64_t *next)
+{
+    uint8_t *ages = &_ages[(size_t) slot * tile_size * tile_size];
+    uint8_t step = (uint8_t) std::min<uint64_t>(_generation - _age_generation[slot] + 1, max_cell_age);
+
+    alignas(16) uint8_t living[tile_size], surviving[tile_size];
+
+    for (int r = 0; r < tile_size; r++)
+    {
+        if ((current[r] | next[r]) == 0)
+        {
+            continue;
+        }
+
+        ByteMasks(current[r], living);
+        ByteMasks(next[r], surviving);
+
+        uint8_t *row = &ages[r * tile_size];
+
+        for (int c = 0; c < tile_size; c++)
+        {
+            uint8_t older = row[c] + step;
+            older = older < row[c] ? max_cell_age : older;
+
+            row[c] = ((older & living[c]) | (1 & ~living[c])) & surviving[c];
+        }
+    }
+
+    _age_generation[slot] = _generation + 1;
+}
+
+/** @fn LifeCycle::SettleAges(int slot)
+ *  @brief Brings the stored ages of a tile to the current generation, before it is edited.
+ *
+ *  Afterwards dead individuals have age 0, so an edit can tell the new individuals from the living ones.
+ */
+void LifeCycle::SettleAges(int slot)
+{
+    const uint64_t *rows = this->HotRows(slot);
+    uint8_t *ages = &_ages[(size_t) slot * tile_size * tile_size];
+    unsigned gap = (unsigned) std::min<uint64_t>(_generation - _age_generation[slot], max_cell_age);
+
+    for (int r = 0; r < tile_size; r++)
+    {
+        for (int c = 0; c < tile_size; c++)
+        {
+            unsigned older = std::min<unsigned>(ages[r * tile_size + c] + gap, max_cell_age);
+
+            ages[r * tile_size + c] = (rows[r] >> c) & 1 ? older : 0;
+        }
+    }
+
+    _age_generation[slot] = _generation;
+}
+
+static uint64_t TileHash(int slot, const uint64_t *rows);
+
+/** @fn LifeCycle::IsAlive(int row, int column)
+ *  @brief Returns the state of one individual.
+ */
+bool LifeCycle::IsAlive(int row, int column) const
+{
+    int slot = this->TileSlot(row / tile_size, column / tile_size);
+
+    return (this->TileRow(slot, row % tile_size) >> (column % tile_size)) & 1;
+}
+
+/** @fn LifeCycle::SetCell(int row, int column, bool alive)
+ *  @brief Sets the state of one individual from outside, e.g. by a remote control.
+ *
+ *  The tile becomes active for the next generation. Individuals outside of the board are ignored.
+ */
+void LifeCycle::SetCell(int row, int column, bool alive)
+{
+    if (row < 0 || row >= _rows || column < 0 || column >= _columns)
+    {
+        return;
+    }
+
+    int slot = this->TileSlot(row / tile_size, column / tile_size);
+
+    if (_cold_of_slot[slot] >= 0)
+    {
+        this->ThawTile(slot);
+    }
+
+    uint64_t *rows = this->FrontRows(slot);
+    uint64_t bit = 1ULL << (column % tile_size);
+
+    if (((rows[row % tile_size] & bit) != 0) == alive)
+    {
+        return;
+    }
+
+    if (!_ages.empty())
+    {
+        this->SettleAges(slot);
+    }
+
+    rows[row % tile_size] ^= bit;
+
+    if (!_ages.empty() && alive)
+    {
+        _ages[((size_t) slot * tile_size + row % tile_size) * tile_size + column % tile_size] = 1;
+    }
+
+    _tile_population[slot] += alive ? 1 : -1;
+    _population += alive ? 1 : -1;
+
+    this->TouchTile(slot);
+    this->FinishEdits();
+}
+
+/** @fn LifeCycle::SetCells(const std::vector<struct_cell_change> &changes)
+ *  @brief Applies a batch of edits, e.g. a painted stroke or a stamped pattern.
+ *
+ *  The bits are flipped first, then every touched tile gets its population, hash and change stamp once.
+ */
+void LifeCycle::SetCells(const std::vector<struct_cell_change> &changes)
+{
+    GOL_PROFILE_SCOPE("LifeCycle::SetCells");
+
+    _touched_slots.clear();
+
+    for (const struct_cell_change &change : changes)
+    {
+        if (change.row < 0 || change.row >= _rows || change.column < 0 || change.column >= _columns)
+        {
+            continue;
+        }
+
+        int slot = this->TileSlot(change.row / tile_size, change.column / tile_size);
+
+        if (_cold_of_slot[slot] >= 0)
+        {
+            this->ThawTile(slot);
+        }
+
+        if (!_touched[slot])
+        {
+            _touched[slot] = 1;
+            _touched_slots.push_back(slot);
+
+            if (!_ages.empty())
+            {
+                this->SettleAges(slot);
+            }
+        }
+
+        uint64_t *rows = this->FrontRows(slot);
+        uint64_t bit = 1ULL << (change.column % tile_size);
+
+        if (change.alive)
+        {
+            rows[change.row % tile_size] |= bit;
+
+            // A new individual, if it was dead. SettleAges() left age 0 for the dead ones.
+            if (!_ages.empty())
+            {
+                uint8_t &age = _ages[((size_t) slot * tile_size + change.row % tile_size) * tile_size +
+                                     change.column % tile_size];
+                age = std::max<uint8_t>(age, 1);
+            }
+        }
+        else
+        {
+            rows[change.row % tile_size] &= ~bit;
+        }
+    }
+
+    if (_touched_slots.empty())
+    {
+        return;
+    }
+
+    for (int slot : _touched_slots)
+    {
+        const uint64_t *rows = this->FrontRows(slot);
+        int population = 0;
+
+        for (int r = 0; r < tile_size; r++)
+        {
+            population += __builtin_popcountll(rows[r]);
+        }
+
+        _population += population - _tile_population[slot];
+        _tile_population[slot] = population;
+        _touched[slot] = 0;
+
+        this->TouchTile(slot);
+    }
+
+    this->FinishEdits();
+}
+
+/** @fn LifeCycle::TouchTile(int slot)
+ *  @brief Updates the hash of an edited tile and marks it as changed.
+ */
+void LifeCycle::TouchTile(int slot)
+{
+    _board_hash ^= _tile_hash[slot];
+    _tile_hash[slot] = TileHash(slot, this->FrontRows(slot));
+    _board_hash ^= _tile_hash[slot];
+
+    // The tiles of the last generation are in the list already, and so are the tiles of earlier edits.
+    if (_tile_stamp[slot] < _commit_stamp)
+    {
+        changed_tiles.push_back(slot);
+    }
+
+    _tile_stamp[slot] = ++_change_stamp;
+
+    if (_events_valid)
+    {
+        _event_dirty_slots.push_back(slot);
+    }
+
+    // An edit repeats nothing, and the back buffer is not the previous generation any more.
+    _tile_aperiodic_stamp[slot] = _change_stamp;
+    _tile_stepped[slot] = 0;
+}
+
+void LifeCycle::FinishEdits()
+{
+    // The old generations are worthless now. A halted life cycle runs again, unless it is at its limit.
+    _cycle_detector.Reset();
+    _halted = _max_generations > 0 && _generation >= _max_generations;
+}
+
+/** @fn LifeCycle::ChangedTilesSince(uint64_t stamp, std::vector<int> &slots)
+ *  @brief Collects the slots of all tiles, which changed after the given change stamp.
+ *
+ *  Other than changed_tiles this covers any number of generations and edits in between, so every consumer can keep
+ *  its own stamp.
+ */
+void LifeCycle::ChangedTilesSince(uint64_t stamp, std::vector<int> &slots) const
+{
+    slots.clear();
+
+    for (int slot = 0; slot < tiles.size(); slot++)
+    {
+        if (_tile_stamp[slot] > stamp)
+        {
+            slots.push_back(slot);
+        }
+    }
+}
+
+/** @fn SplitMix64(uint64_t &state)
+ *  @brief Small random generator, one per tile, so the tiles can be filled in parallel.
+ */
+static inline uint64_t SplitMix64(uint64_t &state)
+{
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+    return z ^ (z >> 31);
+}
+
+void LifeCycle::RandomPatternGenerator()
+{
+    // Every tile has its own random sequence, which depends only on the seed and the position of the tile. So the
+    // pattern is the same with any number of threads, and each worker writes (and first touches) its own tiles.
+    this->DropColdTiles();
+
+    auto fill_tiles = [this](int begin, int end, int worker)
+    {
+        for (int slot = begin; slot < end; slot++)
+        {
+            const struct_tile &tile = tiles[slot];
+            uint64_t state = ((uint64_t) seed << 32) ^ ((uint64_t) tile.tile_row * tiles_x + tile.tile_column);
+            uint64_t *rows = this->BackRows(slot);
+
+            SplitMix64(state);
+
+            for (int r = 0; r < tile_size; r++)
+            {
+                rows[r] = 0;
+
+                for (int c = 0; c < tile_size && r < tile.valid_rows; c++)
+                {
+                    // Decision of life and death. If the random number is smaller than the live rate, the individual
+                    // will live. Otherwise, it will be dead.
+                    if ((SplitMix64(state) >> 32) % 101 < (uint64_t) this->_live_rate)
+                    {
+                        rows[r] |= 1ULL << c;
+                    }
+                }
+
+                rows[r] &= tile.column_mask;
+            }
+
+            // Make the new pattern the current generation.
+            _front[slot] ^= 1;
+        }
+    };
+
+    if (_pool)
+    {
+        _pool->ParallelForStatic(tiles.size(), fill_tiles);
+    }
+    else
+    {
+        fill_tiles(0, tiles.size(), 0);
+    }
+
+    uint64_t state = seed;
+    seed = (unsigned) SplitMix64(state);
+
+    this->MarkAllChanged();
+}
+
+/** @fn LifeCycle::Restart(unsigned seed, int live_rate)
+ *  @brief Starts again with a new random soup, without any new allocation.
+ */
+void LifeCycle::Restart(unsigned seed, int live_rate)
+{
+    this->seed = seed;
+    this->_live_rate = live_rate;
+    this->_generation = 0;
+
+    this->RandomPatternGenerator();
+}
+
+void LifeCycle::Restart(const std::vector<struct_cell_change> &individuals)
+{
+    this->_generation = 0;
+
+    this->EmptyPatternGenerator();
+    this->SetCells(individuals);
+}
+
+void LifeCycle::SinglePatternGenerator()
+{
+    this->MarkAllChanged();
+}
+
+void LifeCycle::EmptyPatternGenerator()
+{
+    this->DropColdTiles();
+    std::fill(_cells.begin(), _cells.end(), 0);
+
+    this->MarkAllChanged();
+}
+
+/** @fn TileHash(int slot, const uint64_t *rows)
+ *  @brief Hash of the content and position of one tile. The hash of the biotope is the XOR of all tile hashes.
+ */
+static uint64_t TileHash(int slot, const uint64_t *rows)
+{
+    // FNV-1a over the words, finished with the mixer of splitmix64.
+    uint64_t hash = 0xcbf29ce484222325ULL ^ ((uint64_t) slot * 0x9e3779b97f4a7c15ULL);
+
+    // The multiplication only carries bits upwards. Without the shift, the columns at the top of a word would only
+    // reach the top bits of the hash, and a glider there would repeat its hash after a few generations.
+    for (int r = 0; r < tile_size; r++)
+    {
+        hash = (hash ^ rows[r]) * 0x100000001b3ULL;
+        hash ^= hash >> 32;
+    }
+
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+
+    return hash ^ (hash >> 31);
+}
+
+/** @fn LifeCycle::MarkAllChanged()
+ *  @brief Marks the whole biotope as changed and active, e.g. after a new pattern was placed.
+ *
+ *  The cold tiles are decoded first, their buffers are stale or released. Only the active tiles freeze again, so the
+ *  event-driven mode, which reads the individuals of every tile, keeps all tiles in their buffers.
+ */
+void LifeCycle::MarkAllChanged()
+{
+    for (int slot = 0; _cold_tile_count > 0 && slot < tiles.size(); slot++)
+    {
+        if (_cold_of_slot[slot] >= 0)
+        {
+            this->ThawTile(slot);
+        }
+    }
+
+    _population = 0;
+    _board_hash = 0;
+    _commit_stamp = ++_change_stamp;
+    changed_tiles.resize(tiles.size());
+
+    for (int slot = 0; slot < tiles.size(); slot++)
+    {
+        const uint64_t *rows = this->HotRows(slot);
+
+        _tile_population[slot] = 0;
+
+        for (int r = 0; r < tile_size; r++)
+        {
+            _tile_population[slot] += __builtin_popcountll(rows[r]);
+        }
+
+        _population += _tile_population[slot];
+        _tile_hash[slot] = TileHash(slot, rows);
+        _board_hash ^= _tile_hash[slot];
+        changed_tiles[slot] = slot;
+        _tile_stamp[slot] = _change_stamp;
+        _tile_aperiodic_stamp[slot] = _change_stamp;
+        _tile_stepped[slot] = 0;
+        _active[slot] = 1;
+    }
+
+    _active_slots = changed_tiles;
+    _events_valid = false;
+
+    // The individuals of a new pattern are born now.
+    if (!_ages.empty())
+    {
+        std::fill(_ages.begin(), _ages.end(), 1);
+        std::fill(_age_generation.begin(), _age_generation.end(), _generation);
+    }
+
+    // The biotope was changed from outside, the old generations are worthless now.
+    _cycle_detector.Reset();
+    _cycle_detector.Update(_generation, _board_hash);
+    _halted = false;
+
+    if (_exporter)
+    {
+        _exporter->Publish(*this);
+    }
+
+    if (_history)
+    {
+        _history->Record(*this);
+    }
+}
+
+/** @fn LifeCycle::ExchangeHalo(int slot, struct_halo &halo)
+ *  @brief Copies the border cells of the eight neighbours of a tile into its halo.
+ *
+ *  Outside of the board there is no life, so missing neighbours give empty borders. Cold neighbours are decoded.
+ */
+void LifeCycle::ExchangeHalo(int slot, struct_halo &halo) const
+{
+    const int *neighbours = tiles[slot].neighbours;
+
+    halo = {0, 0, 0, 0, 0};
+
+    uint64_t buffer[tile_size];
+
+    if (neighbours[1] >= 0) halo.north = this->TileRow(neighbours[1], tile_size - 1);
+    if (neighbours[6] >= 0) halo.south = this->TileRow(neighbours[6], 0);
+
+    if (neighbours[3] >= 0)
+    {
+        const uint64_t *west = this->TileRows(neighbours[3], buffer);
+
+        for (int r = 0; r < tile_size; r++)
+        {
+            halo.west |= (west[r] >> (tile_size - 1)) << r;
+        }
+    }
+
+    if (neighbours[4] >= 0)
+    {
+        const uint64_t *east = this->TileRows(neighbours[4], buffer);
+
+        for (int r = 0; r < tile_size; r++)
+        {
+            halo.east |= (east[r] & 1) << r;
+        }
+    }
+
+    if (neighbours[0] >= 0) halo.corners |= (this->TileRow(neighbours[0], tile_size - 1) >> (tile_size - 1));
+    if (neighbours[2] >= 0) halo.corners |= (this->TileRow(neighbours[2], tile_size - 1) & 1) << 1;
+    if (neighbours[5] >= 0) halo.corners |= (this->TileRow(neighbours[5], 0) >> (tile_size - 1)) << 2;
+    if (neighbours[7] >= 0) halo.corners |= (this->TileRow(neighbours[7], 0) & 1) << 3;
+
+    if (!_outer_halo_enabled || !_on_boundary[slot])
+    {
+        return;
+    }
+
+    // The missing neighbours are outside of the board. Only cells right next to the board are in the outer halo.
+    int row0 = tiles[slot].tile_row * tile_size;
+    int column0 = tiles[slot].tile_column * tile_size;
+
+    if (neighbours[1] < 0) halo.north = _outer_halo.north[tiles[slot].tile_column];
+    if (neighbours[6] < 0 && row0 + tile_size == _rows) halo.south = _outer_halo.south[tiles[slot].tile_column];
+    if (neighbours[3] < 0) halo.west = _outer_halo.west[tiles[slot].tile_row];
+    if (neighbours[4] < 0 && column0 + tile_size == _columns) halo.east = _outer_halo.east[tiles[slot].tile_row];
+
+    if (neighbours[0] < 0) halo.corners |= this->OuterCell(row0 - 1, column0 - 1);
+    if (neighbours[2] < 0) halo.corners |= this->OuterCell(row0 - 1, column0 + tile_size) << 1;
+    if (neighbours[5] < 0) halo.corners |= this->OuterCell(row0 + tile_size, column0 - 1) << 2;
+    if (neighbours[7] < 0) halo.corners |= this->OuterCell(row0 + tile_size, column0 + tile_size) << 3;
+}
+
+/** @fn LifeCycle::OuterCell(int row, int column)
+ *  @brief State of an individual in the outer halo. Everything farther away from the board is dead.
+ */
+uint64_t LifeCycle::OuterCell(int row, int column) const
+{
+    bool above = row == -1, below = row == _rows, left = column == -1, right = column == _columns;
+    bool inside_rows = row >= 0 && row < _rows, inside_columns = column >= 0 && column < _columns;
+
+    if (above && left) return _outer_halo.corners & 1;
+    if (above && right) return (_outer_halo.corners >> 1) & 1;
+    if (below && left) return (_outer_halo.corners >> 2) & 1;
+    if (below && right) return (_outer_halo.corners >> 3) & 1;
+
+    if (above && inside_columns) return (_outer_halo.north[column / tile_size] >> (column % tile_size)) & 1;
+    if (below && inside_columns) return (_outer_halo.south[column / tile_size] >> (column % tile_size)) & 1;
+    if (left && inside_rows) return (_outer_halo.west[row / tile_size] >> (row % tile_size)) & 1;
+    if (right && inside_rows) return (_outer_halo.east[row / tile_size] >> (row % tile_size)) & 1;
+
+    return 0;
+}
+
+/** @fn StepRowsBitwise(const uint64_t *current, const struct_halo &halo, uint64_t *next)
+ *  @brief Applies the rules to all 64 x 64 individuals of one tile at once.
+ *
+ *  The eight neighbours of a row are shifted copies of the row above, the row itself and the row below. They are
+ *  summed up bit-parallel with half adders into the bits "ones", "twos" and "four or more".
+ */
+static inline void StepRowsBitwise(const uint64_t *current, const struct_halo &halo, uint64_t *next)
+{
+    for (int r = 0; r < tile_size; r++)
+    {
+        uint64_t above = r == 0 ? halo.north : current[r - 1];
+        uint64_t middle = current[r];
+        uint64_t below = r == tile_size - 1 ? halo.south : current[r + 1];
+
+        // The cells left of column 0 and right of column 63 come from the west and east halo.
+        uint64_t west_above = r == 0 ? (halo.corners & 1) : (halo.west >> (r - 1)) & 1;
+        uint64_t west_middle = (halo.west >> r) & 1;
+        uint64_t west_below = r == tile_size - 1 ? (halo.corners >> 2) & 1 : (halo.west >> (r + 1)) & 1;
+
+        uint64_t east_above = r == 0 ? (halo.corners >> 1) & 1 : (halo.east >> (r - 1)) & 1;
+        uint64_t east_middle = (halo.east >> r) & 1;
+        uint64_t east_below = r == tile_size - 1 ? (halo.corners >> 3) & 1 : (halo.east >> (r + 1)) & 1;
+
+        uint64_t neighbours[8] =
+        {
+            (above << 1) | west_above, above, (above >> 1) | (east_above << 63),
+            (middle << 1) | west_middle, (middle >> 1) | (east_middle << 63),
+            (below << 1) | west_below, below, (below >> 1) | (east_below << 63)
+        };
+
+        uint64_t ones = 0, twos = 0, four_or_more = 0;
+
+        for (int n = 0; n < 8; n++)
+        {
+            uint64_t carry_one = ones & neighbours[n];
+            ones ^= neighbours[n];
+
+            uint64_t carry_two = twos & carry_one;
+            twos ^= carry_one;
+
+            four_or_more |= carry_two;
+        }
+
+        // Three neighbours: birth or survival. Two neighbours: survival only.
+        next[r] = twos & ~four_or_more & (ones | middle);
+    }
+}
+
+/** @fn StepRowsRule(const uint64_t *current, const struct_halo &halo, const struct_rule &rule, uint64_t *next)
+ *  @brief Like StepRowsBitwise(), but with the full neighbour count for any rule.
+ */
+static inline void StepRowsRule(const uint64_t *current, const struct_halo &halo, const struct_rule &rule,
+                                uint64_t *next)
+{
+    for (int r = 0; r < tile_size; r++)
+    {
+        uint64_t above = r == 0 ? halo.north : current[r - 1];
+        uint64_t middle = current[r];
+        uint64_t below = r == tile_size - 1 ? halo.south : current[r + 1];
+
+        uint64_t west_above = r == 0 ? (halo.corners & 1) : (halo.west >> (r - 1)) & 1;
+        uint64_t west_middle = (halo.west >> r) & 1;
+        uint64_t west_below = r == tile_size - 1 ? (halo.corners >> 2) & 1 : (halo.west >> (r + 1)) & 1;
+
+        uint64_t east_above = r == 0 ? (halo.corners >> 1) & 1 : (halo.east >> (r - 1)) & 1;
+        uint64_t east_middle = (halo.east >> r) & 1;
+        uint64_t east_below = r == tile_size - 1 ? (halo.corners >> 3) & 1 : (halo.east >> (r + 1)) & 1;
+
+        uint64_t neighbours[8] =
+        {
+            (above << 1) | west_above, above, (above >> 1) | (east_above << 63),
+            (middle << 1) | west_middle, (middle >> 1) | (east_middle << 63),
+            (below << 1) | west_below, below, (below >> 1) | (east_below << 63)
+        };
+
+        uint64_t ones = 0, twos = 0, fours = 0, eights = 0;
+
+        for (int n = 0; n < 8; n++)
+        {
+            uint64_t carry_one = ones & neighbours[n];
+            ones ^= neighbours[n];
+
+            uint64_t carry_two = twos & carry_one;
+            twos ^= carry_one;
+
+            uint64_t carry_four = fours & carry_two;
+            fours ^= carry_two;
+
+            eights |= carry_four;
+        }
+
+        next[r] = ApplyRule(rule, middle, ones, twos, fours, eights);
+    }
+}
+
+/** @fn LifeCycle::StepTile(int slot)
+ *  @brief Calculates the next generation of one tile into its back buffer.
+ */
+void LifeCycle::StepTile(int slot)
+{
+    struct_halo halo;
+    this->ExchangeHalo(slot, halo);
+
+    const uint64_t *current = this->HotRows(slot);
+    uint64_t *next = this->BackRows(slot);
+
+    // The back buffer still holds the previous generation, if the tile was stepped in the last generation.
+    uint64_t previous[tile_size];
+    bool known_previous = _cold_generations > 0 && _tile_stepped[slot] == _generation;
+
+    if (known_previous)
+    {
+        std::copy(next, next + tile_size, previous);
+    }
+
+    _tile_stepped[slot] = _generation + 1;
+
+    // Both kernels know only the rule of Conway.
+    if (_rule != conway_rule)
+    {
+        StepRowsRule(current, halo, _rule, next);
+    }
+    else if (kernel_enum == step_kernel::lookup_table)
+    {
+        StepRowsLookup(current, halo, next);
+    }
+    else
+    {
+        StepRowsBitwise(current, halo, next);
+    }
+
+    const struct_tile &tile = tiles[slot];
+
+    bool changed = false, repeated = known_previous;
+    int population = 0;
+
+    for (int r = 0; r < tile_size; r++)
+    {
+        // Cells outside of the board stay dead.
+        next[r] = r < tile.valid_rows ? next[r] & tile.column_mask : 0;
+
+        changed |= next[r] != current[r];
+        repeated = repeated && next[r] == previous[r];
+        population += __builtin_popcountll(next[r]);
+    }
+
+    _tile_changed[slot] = changed;
+    _tile_aperiodic[slot] = known_previous ? !repeated : changed;
+    _tile_population[slot] = population;
+
+    if (changed)
+    {
+        _tile_new_hash[slot] = TileHash(slot, next);
+
+        if (!_ages.empty())
+        {
+            this->UpdateAges(slot, current, next);
+        }
+    }
+}
+
+/** @fn LifeCycle::SizeEvents()
+ *  @brief Sizes the counts and the lists of the event-driven mode once, so that stepping does not allocate.
+ *
+ *  An individual is queued and flipped at most once per generation, so the lists never hold more than the board.
+ *  Their reservations are only backed by memory, as far as the lists reach.
+ */
+void LifeCycle::SizeEvents()
+{
+    uint64_t cells = (uint64_t) _rows * _columns;
+
+    _neighbour_counts.resize(cells);
+    _event_queued.resize((cells + 63) / 64);
+    _event_cells.reserve(cells);
+    _event_next.reserve(cells);
+    _event_flips.reserve(cells);
+    _event_dirty_slots.reserve(tiles.size());
+}
+
+/** @fn LifeCycle::RebuildEvents()
+ *  @brief Counts the living neighbours of all individuals and queues every individual, which could change.
+ *
+ *  Only the living individuals are visited, so the count takes as long as the population, not as the board.
+ */
+void LifeCycle::RebuildEvents()
+{
+    GOL_PROFILE_SCOPE("LifeRules::rebuild_events");
+
+    this->SizeEvents();
+
+    std::fill(_neighbour_counts.begin(), _neighbour_counts.end(), 0);
+    std::fill(_event_queued.begin(), _event_queued.end(), 0);
+    _event_next.clear();
+    _event_dirty_slots.clear();
+
+    uint64_t buffer[tile_size];
+
+    for (int slot = 0; slot < tiles.size(); slot++)
+    {
+        const uint64_t *rows = this->TileRows(slot, buffer);
+
+        for (int r = 0; r < tile_size; r++)
+        {
+            for (uint64_t bits = rows[r]; bits != 0; bits &= bits - 1)
+            {
+                int row = tiles[slot].tile_row * tile_size + r;
+                int column = tiles[slot].tile_column * tile_size + __builtin_ctzll(bits);
+
+                for (int y = std::max(row - 1, 0); y <= std::min(row + 1, _rows - 1); y++)
+                {
+                    for (int x = std::max(column - 1, 0); x <= std::min(column + 1, _columns - 1); x++)
+                    {
+                        uint64_t cell = (uint64_t) y * _columns + x;
+
+                        _neighbour_counts[cell] += y != row || x != column;
+                        this->QueueEvent(cell);
+                    }
+                }
+            }
+        }
+    }
+
+    _events_valid = true;
+}
+
+/** @fn LifeCycle::RecountEventTile(int slot)
+ *  @brief Counts the neighbours of an edited tile and of the ring of individuals around it again.
+ */
+void LifeCycle::RecountEventTile(int slot)
+{
+    const struct_tile &tile = tiles[slot];
+
+    int top = std::max(tile.tile_row * tile_size - 1, 0);
+    int bottom = std::min((tile.tile_row + 1) * tile_size, _rows - 1);
+    int left = std::max(tile.tile_column * tile_size - 1, 0);
+    int right = std::min((tile.tile_column + 1) * tile_size, _columns - 1);
+
+    for (int row = top; row <= bottom; row++)
+    {
+        for (int column = left; column <= right; column++)
+        {
+            int count = 0;
+
+            for (int y = std::max(row - 1, 0); y <= std::min(row + 1, _rows - 1); y++)
+            {
+                for (int x = std::max(column - 1, 0); x <= std::min(column + 1, _columns - 1); x++)
+                {
+                    count += (y != row || x != column) && this->IsAlive(y, x);
+                }
+            }
+
+            uint64_t cell = (uint64_t) row * _columns + column;
+            _neighbour_counts[cell] = count;
+
+            if (count > 0 || this->IsAlive(row, column))
+            {
+                this->QueueEvent(cell);
+            }
+        }
+    }
+}
+
+/** @fn LifeCycle::StepEvents()
+ *  @brief Calculates the next generation from the individuals, whose neighbourhood changed in the last generation.
+ *
+ *  Every individual keeps the number of its living neighbours. Only the queued individuals are evaluated: the ones,
+ *  whose count changed, and the ones, which changed themselves. A birth or death adds or subtracts one from the
+ *  counts of its eight neighbours and queues them for the next generation. The tiles with births or deaths get their
+ *  front buffer copied to the back buffer once, before their individuals are flipped there, and become the changed
+ *  tiles of CommitGeneration(). For a sparse biotope the work follows the births and deaths, not the tiles.
+ */
+void LifeCycle::StepEvents()
+{
+    GOL_PROFILE_SCOPE("LifeRules::step_events");
+
+    if (!_events_valid)
+    {
+        this->RebuildEvents();
+    }
+    else if (!_event_dirty_slots.empty())
+    {
+        std::sort(_event_dirty_slots.begin(), _event_dirty_slots.end());
+        _event_dirty_slots.erase(std::unique(_event_dirty_slots.begin(), _event_dirty_slots.end()),
+                                 _event_dirty_slots.end());
+
+        for (int slot : _event_dirty_slots)
+        {
+            this->RecountEventTile(slot);
+        }
+
+        _event_dirty_slots.clear();
+    }
+
+    _event_cells.swap(_event_next);
+    _event_next.clear();
+    _event_flips.clear();
+
+    // Evaluate the queued individuals with the counts of the current generation.
+    for (uint64_t cell : _event_cells)
+    {
+        _event_queued[cell / 64] &= ~(1ULL << (cell % 64));
+
+        int row = (int) (cell / _columns), column = (int) (cell % _columns);
+        int slot = this->TileSlot(row / tile_size, column / tile_size);
+
+        bool alive = (this->HotRows(slot)[row % tile_size] >> (column % tile_size)) & 1;
+        int count = _neighbour_counts[cell];
+
+        if (alive != (((alive ? _rule.survive : _rule.birth) >> count) & 1))
+        {
+            _event_flips.push_back(cell);
+        }
+    }
+
+    _active_slots.clear();
+
+    for (uint64_t cell : _event_flips)
+    {
+        int row = (int) (cell / _columns), column = (int) (cell % _columns);
+        int slot = this->TileSlot(row / tile_size, column / tile_size);
+
+        // A tile is copied once, with its first birth or death of the generation.
+        if (_tile_stepped[slot] != _generation + 1)
+        {
+            _tile_stepped[slot] = _generation + 1;
+            _active_slots.push_back(slot);
+
+            std::copy(this->HotRows(slot), this->HotRows(slot) + tile_size, this->BackRows(slot));
+        }
+
+        uint64_t *next = this->BackRows(slot);
+        next[row % tile_size] ^= 1ULL << (column % tile_size);
+
+        int born = (next[row % tile_size] >> (column % tile_size)) & 1;
+        _tile_population[slot] += born ? 1 : -1;
+
+        for (int y = std::max(row - 1, 0); y <= std::min(row + 1, _rows - 1); y++)
+        {
+            for (int x = std::max(column - 1, 0); x <= std::min(column + 1, _columns - 1); x++)
+            {
+                uint64_t neighbour = (uint64_t) y * _columns + x;
+
+                if (neighbour != cell)
+                {
+                    _neighbour_counts[neighbour] += born ? 1 : -1;
+                }
+
+                this->QueueEvent(neighbour);
+            }
+        }
+    }
+
+    for (int slot : _active_slots)
+    {
+        _tile_changed[slot] = 1;
+        _tile_aperiodic[slot] = 1;
+        _tile_new_hash[slot] = TileHash(slot, this->BackRows(slot));
+
+        if (!_ages.empty())
+        {
+            this->UpdateAges(slot, this->HotRows(slot), this->BackRows(slot));
+        }
+    }
+}
+
+/** @fn LifeCycle::FlagActiveTiles()
+ *  @brief Flags the changed tiles and their neighbours and returns their number.
+ */
+int LifeCycle::FlagActiveTiles()
+{
+    int count = 0;
+
+    std::fill(_active.begin(), _active.end(), 0);
+
+    // The outer halo can change in any generation.
+    if (_outer_halo_enabled)
+    {
+        for (int slot = 0; slot < tiles.size(); slot++)
+        {
+            count += _on_boundary[slot];
+            _active[slot] = _on_boundary[slot];
+        }
+    }
+
+    for (int slot : changed_tiles)
+    {
+        // Cold tiles repeat themselves, and so does their neighbourhood. Only a tile, which does not repeat the
+        // generation before the last one, wakes up its cold neighbours.
+        if (_cold_of_slot[slot] >= 0)
+        {
+            continue;
+        }
+
+        bool waking = _tile_aperiodic_stamp[slot] >= _commit_stamp;
+
+        count += !_active[slot];
+        _active[slot] = 1;
+
+        for (int n = 0; n < 8; n++)
+        {
+            int neighbour = tiles[slot].neighbours[n];
+
+            if (neighbour >= 0 && (waking || _cold_of_slot[neighbour] < 0))
+            {
+                count += !_active[neighbour];
+                _active[neighbour] = 1;
+            }
+        }
+    }
+
+    // Oscillators, which stopped, did not change, but their cold neighbours expect the other phase.
+    for (int slot : _waking_slots)
+    {
+        for (int n = 0; n < 8; n++)
+        {
+            int neighbour = tiles[slot].neighbours[n];
+
+            if (neighbour >= 0 && _cold_of_slot[neighbour] >= 0)
+            {
+                count += !_active[neighbour];
+                _active[neighbour] = 1;
+            }
+        }
+    }
+
+    return count;
+}
+
+/** @fn LifeCycle::UpdateActiveTiles()
+ *  @brief Collects the tiles for the next generation: the changed tiles and their neighbours.
+ */
+void LifeCycle::UpdateActiveTiles()
+{
+    // StepEvents() finds the changed tiles on its own.
+    if (this->EventDriven())
+    {
+        return;
+    }
+
+    if (step_mode_enum == step_mode::full_sweep)
+    {
+        if (_active_slots.size() != tiles.size())
+        {
+            _active_slots.resize(tiles.size());
+
+            for (int slot = 0; slot < tiles.size(); slot++)
+            {
+                _active_slots[slot] = slot;
+            }
+        }
+
+        this->ThawActiveTiles();
+        return;
+    }
+
+    this->FlagActiveTiles();
+
+    // Scanning the flags keeps the list in Z-order.
+    _active_slots.clear();
+
+    for (int slot = 0; slot < tiles.size(); slot++)
+    {
+        if (_active[slot])
+        {
+            _active_slots.push_back(slot);
+        }
+    }
+
+    this->ThawActiveTiles();
+}
+
+/** @fn LifeCycle::SampleEngine()
+ *  @brief Measures density and churn and lets the selector choose the step mode.
+ */
+void LifeCycle::SampleEngine()
+{
+    _sample_generations++;
+    _sample_stepped += _active_slots.size();
+    _sample_changed += changed_tiles.size();
+
+    if (_sample_generations < _selector->Interval())
+    {
+        return;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(now - _sample_start).count();
+    double tile_count = tiles.size();
+
+    struct_engine_sample sample;
+
+    sample.generation = _generation;
+    sample.population = _population;
+    sample.density = (double) _population / ((double) _rows * _columns);
+    sample.active_fraction = this->FlagActiveTiles() / tile_count;
+    sample.stepped_fraction = _sample_stepped / (tile_count * _sample_generations);
+    sample.churn = _sample_changed / (tile_count * _sample_generations);
+    sample.generations_per_second = seconds > 0.0 ? _sample_generations / seconds : 0.0;
+
+    step_mode next = _selector->Select(sample, step_mode_enum);
+
+    if (next != step_mode_enum)
+    {
+        this->SwitchStepMode(next);
+    }
+
+    _sample_generations = 0;
+    _sample_stepped = 0;
+    _sample_changed = 0;
+    _sample_start = std::chrono::steady_clock::now();
+}
+
+/** @fn LifeCycle::SwitchStepMode(step_mode mode)
+ *  @brief Changes the step mode between two generations.
+ *
+ *  Both modes share the tiles and the list of changed tiles, which is all the active tiles need to continue.
+ */
+void LifeCycle::SwitchStepMode(step_mode mode)
+{
+    step_mode_enum = mode;
+}
+
+void LifeCycle::LifeRules()
+{
+    if (!this->BeginGeneration())
+    {
+        return;
+    }
+
+    if (this->EventDriven())
+    {
+        this->StepEvents();
+    }
+    else
+    {
+        this->StepTiles(_active_slots);
+    }
+
+    this->CommitGeneration();
+}
+
+/** @fn LifeCycle::BeginGeneration()
+ *  @brief Collects the tiles of the next generation. Returns false, if the life cycle is halted.
+ *
+ *  LifeRules() is BeginGeneration(), the stepping of the tiles and CommitGeneration(). The steps are public for the
+ *  distributed mode, which steps the interior tiles, while the outer halo is still on its way.
+ */
+bool LifeCycle::BeginGeneration()
+{
+    if (_halted)
+    {
+        changed_tiles.clear();
+        _commit_stamp = ++_change_stamp;
+        return false;
+    }
+
+    this->UpdateActiveTiles();
+
+    return true;
+}
+
+/** @fn LifeCycle::StepInteriorTiles()
+ *  @brief Steps the active tiles, which do not touch the border of the board.
+ */
+void LifeCycle::StepInteriorTiles()
+{
+    _interior_slots.clear();
+    _boundary_slots.clear();
+
+    for (int slot : _active_slots)
+    {
+        (_on_boundary[slot] ? _boundary_slots : _interior_slots).push_back(slot);
+    }
+
+    this->StepTiles(_interior_slots);
+}
+
+/** @fn LifeCycle::StepBoundaryTiles()
+ *  @brief Steps the active tiles at the border of the board. Has to follow StepInteriorTiles().
+ */
+void LifeCycle::StepBoundaryTiles()
+{
+    this->StepTiles(_boundary_slots);
+}
+
+void LifeCycle::StepTiles(const std::vector<int> &slots)
+{
+    GOL_PROFILE_SCOPE("LifeRules::step_tiles");
+
+    // The neighbour counts of the event-driven mode do not follow the tiles.
+    _events_valid = false;
+
+    // Every tile reads only the current generation and writes only its own back buffer, therefore the tiles can be
+    // stepped in any order and on any thread.
+    auto step_tiles = [this, &slots](int begin, int end, int worker)
+    {
+        for (int i = begin; i < end; i++)
+        {
+            this->StepTile(slots[i]);
+        }
+    };
+
+    // Pinned workers keep their part of the tiles, so the tiles stay in the memory of their NUMA node.
+    if (_pool && _pool->Pinned())
+    {
+        _pool->ParallelForStatic(slots.size(), step_tiles);
+    }
+    else if (_pool)
+    {
+        _pool->ParallelFor(slots.size(), 16, step_tiles);
+    }
+    else
+    {
+        for (int slot : slots)
+        {
+            this->StepTile(slot);
+        }
+    }
+}
+
+/** @fn LifeCycle::CommitGeneration()
+ *  @brief Makes the stepped tiles the current generation.
+ */
+void LifeCycle::CommitGeneration()
+{
+    GOL_PROFILE_SCOPE("LifeRules::commit");
+
+    // Swap the buffers of the changed tiles. The unchanged tiles keep their front buffer.
+    changed_tiles.clear();
+    _waking_slots.clear();
+    _population = 0;
+    _commit_stamp = ++_change_stamp;
+
+    for (int slot : _active_slots)
+    {
+        if (_tile_aperiodic[slot])
+        {
+            _tile_aperiodic_stamp[slot] = _change_stamp;
+
+            if (!_tile_changed[slot])
+            {
+                _waking_slots.push_back(slot);
+            }
+        }
+
+        if (_tile_changed[slot])
+        {
+            _front[slot] ^= 1;
+            changed_tiles.push_back(slot);
+            _tile_stamp[slot] = _change_stamp;
+
+            // Rolling hash: only the changed tiles are exchanged.
+            _board_hash ^= _tile_hash[slot] ^ _tile_new_hash[slot];
+            _tile_hash[slot] = _tile_new_hash[slot];
+        }
     }
-    
-    // Copy back.
-    LifeCycle::individuals = copy_of_individuals;
+
+    for (int slot = 0; slot < tiles.size(); slot++)
+    {
+        _population += _tile_population[slot];
+    }
+
+    _generation++;
+
+    // The cold oscillators change without being stepped.
+    if (!_cold_oscillating.empty())
+    {
+        this->AdvanceColdTiles();
+    }
+
+    _population += _cold_population[_generation & 1];
+
+    // The border is not the end of the world with an outer halo, the spaceships fly on to the neighbouring block.
+    if (_edge_monitor && !_outer_halo_enabled)
+    {
+        _edge_monitor->Check(*this);
+    }
+
+    this->CheckCycle();
+
+    // The objects are counted at the interval and once at the start of a cycle, when the biotope has settled.
+    if (_census)
+    {
+        bool cycle_started = _cycle_detector.cycle.detected && !_census_cycle;
+        _census_cycle = _cycle_detector.cycle.detected;
+
+        if (cycle_started || (_census_interval > 0 && _generation % _census_interval == 0))
+        {
+            this->TakeCensus();
+
+            if (_verbose) _census->Report(10);
+        }
+    }
+
+    if (_selector)
+    {
+        this->SampleEngine();
+    }
+
+    if (_exporter)
+    {
+        GOL_PROFILE_SCOPE("LifeRules::publish");
+        _exporter->Publish(*this);
+    }
+
+    if (_history)
+    {
+        _history->Record(*this);
+    }
+
+    this->FreezeQuietTiles();
+}
+
+/** @fn LifeCycle::CheckCycle()
+ *  @brief Looks for a repetition of the biotope and applies the configured action.
+ *
+ *  Once the biotope is in a cycle, the generation onset + k * period looks exactly like the generation onset. So the
+ *  generation counter can jump over whole periods without calculating them.
+ */
+void LifeCycle::CheckCycle()
+{
+    if (_cycle_detector.Update(_generation, _board_hash))
+    {
+        const struct_cycle &cycle = _cycle_detector.cycle;
+
+        if (_verbose)
+        {
+            fprintf(stdout,"\nThe biotope repeats itself with a period of %lu since generation %lu (population %lu).\n",
+                    (unsigned long) cycle.period, (unsigned long) cycle.onset, (unsigned long) _population);
+
+            if (_edge_monitor && _edge_monitor->Emitted() > 0)
+            {
+                fprintf(stdout,"%s.\n", _edge_monitor->Describe().c_str());
+            }
+        }
+
+        if (cycle_action_enum == cycle_action::halt)
+        {
+            if (_verbose) fprintf(stdout,"The life cycle halts in generation %lu.\n", (unsigned long) _generation);
+            _halted = true;
+        }
+        else if (cycle_action_enum == cycle_action::fast_forward && _max_generations > _generation)
+        {
+            _generation += (_max_generations - _generation) / cycle.period * cycle.period;
+
+            if (_verbose) fprintf(stdout,"Fast forward to generation %lu.\n", (unsigned long) _generation);
+        }
+    }
+
+    if (_max_generations > 0 && _generation >= _max_generations)
+    {
+        if (!_halted && _verbose)
+        {
+            fprintf(stdout,"\nThe maximum number of %lu generations is reached.\n", (unsigned long) _max_generations);
+        }
+
+        _halted = true;
+    }
+}
+
+
+/** @fn CodeHash(const std::vector<uint8_t> &code)
+ *  @brief FNV-1a hash of the code of a cold tile, the key of the shared codes.
+ */
+static uint64_t CodeHash(const std::vector<uint8_t> &code)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    for (uint8_t byte : code)
+    {
+        hash = (hash ^ byte) * 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+// Codes up to this size are shared between tiles with the same content, e.g. the empty tiles and the tiles with a
+// single block. Larger codes are almost never the same.
+static constexpr size_t shared_code_size = 16;
+
+/** @fn LifeCycle::FreezeQuietTiles()
+ *  @brief Compresses the tiles, which and whose neighbours only repeated themselves since the last sweep.
+ *
+ *  The sweep runs every _cold_generations generations. A tile repeats itself, if it is equal to the generation before
+ *  the last one: still lifes and oscillators with the period 2 like the blinker, which is in almost every tile of the
+ *  ash. With repeating neighbours the tile goes on like this on its own, until a neighbour does something else.
+ */
+void LifeCycle::FreezeQuietTiles()
+{
+    if (_cold_generations <= 0 || step_mode_enum != step_mode::active_tiles || --_cold_sweep_countdown > 0)
+    {
+        return;
+    }
+
+    GOL_PROFILE_SCOPE("LifeRules::freeze");
+
+    _cold_sweep_countdown = _cold_generations;
+    _frozen_slots.clear();
+
+    for (int slot = 0; slot < tiles.size(); slot++)
+    {
+        // A tile, which changed in the last generation, needs the previous generation as its other phase. It is not
+        // known after a fast forward.
+        if (_cold_of_slot[slot] >= 0 || _tile_aperiodic_stamp[slot] > _cold_sweep_stamp ||
+            (_tile_stamp[slot] >= _commit_stamp && _tile_stepped[slot] != _generation) ||
+            (_outer_halo_enabled && _on_boundary[slot]))
+        {
+            continue;
+        }
+
+        bool quiet = true;
+
+        for (int n = 0; n < 8 && quiet; n++)
+        {
+            int neighbour = tiles[slot].neighbours[n];
+
+            quiet = neighbour < 0 || _tile_aperiodic_stamp[neighbour] <= _cold_sweep_stamp;
+        }
+
+        if (quiet)
+        {
+            this->FreezeTile(slot);
+            _frozen_slots.push_back(slot);
+        }
+    }
+
+    _cold_sweep_stamp = _change_stamp;
+
+    this->ReleasePages(_frozen_slots);
+}
+
+/** @fn LifeCycle::FreezeTile(int slot)
+ *  @brief Replaces the rows of a tile by the code of its phase in the even generations and the XOR of both phases.
+ */
+void LifeCycle::FreezeTile(int slot)
+{
+    // A tile, which was not stepped in the last generation, did not change.
+    const uint64_t *current = this->HotRows(slot);
+    const uint64_t *other = _tile_stepped[slot] == _generation ? this->BackRows(slot) : current;
+    const uint64_t *even = _generation & 1 ? other : current;
+    uint64_t delta[tile_size], differences = 0;
+    int other_population = 0;
+
+    for (int r = 0; r < tile_size; r++)
+    {
+        delta[r] = current[r] ^ other[r];
+        differences |= delta[r];
+        other_population += __builtin_popcountll(other[r]);
+    }
+
+    _cold_code.clear();
+    EncodeTileRows(even, _cold_code);
+
+    size_t split = _cold_code.size();
+    EncodeTileRows(delta, _cold_code);
+
+    bool shared = _cold_code.size() <= shared_code_size;
+    uint64_t key = shared ? CodeHash(_cold_code) : 0;
+    int cold = -1;
+
+    if (shared)
+    {
+        auto it = _shared_cold_tiles.find(key);
+
+        if (it != _shared_cold_tiles.end() && _cold_tiles[it->second].code == _cold_code)
+        {
+            cold = it->second;
+        }
+    }
+
+    if (cold < 0)
+    {
+        if (_free_cold_tiles.empty())
+        {
+            cold = _cold_tiles.size();
+            _cold_tiles.emplace_back();
+        }
+        else
+        {
+            cold = _free_cold_tiles.back();
+            _free_cold_tiles.pop_back();
+        }
+
+        struct_cold_tile &tile = _cold_tiles[cold];
+
+        tile.code.assign(_cold_code.begin(), _cold_code.end());
+        tile.split = split;
+        tile.references = 0;
+        tile.oscillating = differences != 0;
+        _cold_bytes += _cold_code.size();
+
+        if (shared)
+        {
+            _shared_cold_tiles[key] = cold;
+        }
+    }
+
+    // The phases leave the hot tiles and count in the sums of the cold tiles.
+    int parity = _generation & 1;
+
+    _cold_hash[parity] ^= _tile_hash[slot];
+    _cold_hash[parity ^ 1] ^= current == other ? _tile_hash[slot] : TileHash(slot, other);
+    _cold_population[parity] += _tile_population[slot];
+    _cold_population[parity ^ 1] += other_population;
+    _tile_population[slot] = 0;
+
+    if (_cold_tiles[cold].oscillating)
+    {
+        _cold_oscillating.push_back(slot);
+    }
+
+    _cold_tiles[cold].references++;
+    _cold_of_slot[slot] = cold;
+    _cold_tile_count++;
+}
+
+/** @fn LifeCycle::ThawTile(int slot)
+ *  @brief Decodes a cold tile into its buffers again: the current phase into the front, the other into the back.
+ *
+ *  The back buffer is the previous generation then, just like after a step. The ages are brought to the current
+ *  generation before, while the flipping individuals of an oscillator can still be told from the others.
+ */
+void LifeCycle::ThawTile(int slot)
+{
+    int cold = _cold_of_slot[slot];
+    int parity = _generation & 1;
+
+    if (!_ages.empty())
+    {
+        uint8_t *ages = &_ages[(size_t) slot * tile_size * tile_size];
+
+        this->TileAges(slot, ages);
+        _age_generation[slot] = _generation;
+    }
+
+    _cold_of_slot[slot] = -1;
+    _cold_tile_count--;
+
+    uint64_t *current = this->FrontRows(slot);
+    uint64_t *other = this->BackRows(slot);
+
+    this->DecodeColdTile(cold, parity, current);
+    this->DecodeColdTile(cold, parity ^ 1, other);
+
+    int population = 0, other_population = 0;
+
+    for (int r = 0; r < tile_size; r++)
+    {
+        population += __builtin_popcountll(current[r]);
+        other_population += __builtin_popcountll(other[r]);
+    }
+
+    _tile_hash[slot] = TileHash(slot, current);
+    _tile_population[slot] = population;
+    _tile_stepped[slot] = _generation;
+
+    _cold_hash[parity] ^= _tile_hash[slot];
+    _cold_hash[parity ^ 1] ^= TileHash(slot, other);
+    _cold_population[parity] -= population;
+    _cold_population[parity ^ 1] -= other_population;
+
+    if (_cold_tiles[cold].oscillating)
+    {
+        _cold_list_dirty = true;
+    }
+
+    this->ReleaseColdTile(cold);
+}
+
+/** @fn LifeCycle::ThawActiveTiles()
+ *  @brief Decodes the cold tiles, which were woken up by a neighbour. Their neighbours can stay cold.
+ */
+void LifeCycle::ThawActiveTiles()
+{
+    if (_cold_tile_count == 0)
+    {
+        return;
+    }
+
+    for (int slot : _active_slots)
+    {
+        if (_cold_of_slot[slot] >= 0)
+        {
+            this->ThawTile(slot);
+        }
+    }
+}
+
+/** @fn LifeCycle::AdvanceColdTiles()
+ *  @brief Turns the cold oscillators to their next phase: into the hash and into the list of changed tiles.
+ */
+void LifeCycle::AdvanceColdTiles()
+{
+    if (_cold_list_dirty)
+    {
+        auto thawed = [this](int slot)
+        {
+            return _cold_of_slot[slot] < 0 || !_cold_tiles[_cold_of_slot[slot]].oscillating;
+        };
+
+        _cold_oscillating.erase(std::remove_if(_cold_oscillating.begin(), _cold_oscillating.end(), thawed),
+                                _cold_oscillating.end());
+        _cold_list_dirty = false;
+    }
+
+    _board_hash ^= _cold_hash[0] ^ _cold_hash[1];
+
+    for (int slot : _cold_oscillating)
+    {
+        changed_tiles.push_back(slot);
+        _tile_stamp[slot] = _change_stamp;
+    }
+}
+
+void LifeCycle::ReleaseColdTile(int cold)
+{
+    struct_cold_tile &tile = _cold_tiles[cold];
+
+    if (--tile.references > 0)
+    {
+        return;
+    }
+
+    if (tile.code.size() <= shared_code_size)
+    {
+        auto it = _shared_cold_tiles.find(CodeHash(tile.code));
+
+        if (it != _shared_cold_tiles.end() && it->second == cold)
+        {
+            _shared_cold_tiles.erase(it);
+        }
+    }
+
+    _cold_bytes -= tile.code.size();
+    std::vector<uint8_t>().swap(tile.code);
+    _free_cold_tiles.push_back(cold);
+}
+
+/** @fn LifeCycle::DropColdTiles()
+ *  @brief Forgets all cold tiles, before the whole biotope is overwritten.
+ */
+void LifeCycle::DropColdTiles()
+{
+    if (_cold_tile_count == 0)
+    {
+        return;
+    }
+
+    std::fill(_cold_of_slot.begin(), _cold_of_slot.end(), -1);
+    _cold_tiles.clear();
+    _free_cold_tiles.clear();
+    _shared_cold_tiles.clear();
+    _cold_oscillating.clear();
+    _cold_hash[0] = _cold_hash[1] = 0;
+    _cold_population[0] = _cold_population[1] = 0;
+    _cold_tile_count = 0;
+    _cold_bytes = 0;
+}
+
+/** @fn LifeCycle::ReleasePages(const std::vector<int> &slots)
+ *  @brief Gives the memory pages back to the system, which hold only buffers of cold tiles.
+ *
+ *  A released page reads as zeros and is mapped again, when a tile on it is decoded. The cold tiles do not read their
+ *  buffers, so it does not matter, what is left in them.
+ */
+void LifeCycle::ReleasePages(const std::vector<int> &slots)
+{
+    static const uintptr_t page_size = sysconf(_SC_PAGESIZE);
+    const uintptr_t tile_bytes = tile_stride * sizeof(uint64_t);
+    const uintptr_t begin = (uintptr_t) _cells.data(), end = begin + _cells.size() * sizeof(uint64_t);
+
+    std::vector<uintptr_t> pages;
+
+    for (int slot : slots)
+    {
+        uintptr_t first = (begin + slot * tile_bytes) & ~(page_size - 1);
+        uintptr_t last = (begin + (slot + 1) * tile_bytes - 1) & ~(page_size - 1);
+
+        for (uintptr_t page = first; page <= last; page += page_size)
+        {
+            if (page < begin || page + page_size > end)
+            {
+                continue;
+            }
+
+            bool cold = true;
+
+            for (uintptr_t s = (page - begin) / tile_bytes; s <= (page + page_size - 1 - begin) / tile_bytes; s++)
+            {
+                cold &= _cold_of_slot[s] >= 0;
+            }
+
+            if (cold)
+            {
+                pages.push_back(page);
+            }
+        }
+    }
+
+    std::sort(pages.begin(), pages.end());
+    pages.erase(std::unique(pages.begin(), pages.end()), pages.end());
+
+    for (size_t i = 0; i < pages.size(); )
+    {
+        size_t j = i + 1;
+
+        while (j < pages.size() && pages[j] == pages[j - 1] + page_size)
+        {
+            j++;
+        }
+
+        madvise((void *) pages[i], (j - i) * page_size, MADV_DONTNEED);
+        i = j;
+    }
+}
+
+/** @fn LifeCycle::DecodeColdTile(int cold, int parity, uint64_t *rows)
+ *  @brief Decodes the phase of the even (parity 0) or odd (parity 1) generations of a cold tile.
+ */
+void LifeCycle::DecodeColdTile(int cold, int parity, uint64_t *rows) const
+{
+    const struct_cold_tile &tile = _cold_tiles[cold];
+
+    DecodeTileRows(tile.code.data(), tile.split, rows);
+
+    if (parity && tile.oscillating)
+    {
+        uint64_t delta[tile_size];
+
+        DecodeTileRows(tile.code.data() + tile.split, tile.code.size() - tile.split, delta);
+
+        for (int r = 0; r < tile_size; r++)
+        {
+            rows[r] ^= delta[r];
+        }
+    }
+}
+
+uint64_t LifeCycle::ColdTileFlips(int slot, int row) const
+{
+    int cold = _cold_of_slot[slot];
+
+    if (cold < 0 || !_cold_tiles[cold].oscillating)
+    {
+        return 0;
+    }
+
+    const struct_cold_tile &tile = _cold_tiles[cold];
+
+    return DecodeTileRow(tile.code.data() + tile.split, tile.code.size() - tile.split, row);
+}
+
+const uint64_t *LifeCycle::ColdTileRows(int slot, uint64_t *buffer) const
+{
+    this->DecodeColdTile(_cold_of_slot[slot], _generation & 1, buffer);
+
+    return buffer;
 }
 
+uint64_t LifeCycle::ColdTileRow(int slot, int row) const
+{
+    const struct_cold_tile &tile = _cold_tiles[_cold_of_slot[slot]];
+    uint64_t value = DecodeTileRow(tile.code.data(), tile.split, row);
+
+    if ((_generation & 1) && tile.oscillating)
+    {
+        value ^= DecodeTileRow(tile.code.data() + tile.split, tile.code.size() - tile.split, row);
+    }
+
+    return value;
+}
 
 }
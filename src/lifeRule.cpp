@@ -0,0 +1,98 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    lifeRule.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Rules of life as compile-time constants.
+ *
+ * This program part reads and writes the rules chosen at runtime in the usual notation.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <ctype.h>
+
+#include "lifeRule.hpp"
+
+
+namespace GameOfLife
+{
+
+/** @fn ParseRule(std::string text, struct_rule &rule)
+ *  @brief Reads a rule in the notation B3/S23. The slash and the case of the letters do not matter.
+ */
+bool ParseRule(std::string text, struct_rule &rule)
+{
+    struct_rule parsed = {0, 0};
+    uint16_t *part = nullptr;
+    bool birth_seen = false, survive_seen = false;
+
+    for (char symbol : text)
+    {
+        if (toupper(symbol) == 'B' && !birth_seen && !survive_seen)
+        {
+            part = &parsed.birth;
+            birth_seen = true;
+        }
+        else if (toupper(symbol) == 'S' && birth_seen && !survive_seen)
+        {
+            part = &parsed.survive;
+            survive_seen = true;
+        }
+        else if (symbol == '/' && part == &parsed.birth)
+        {
+            continue;
+        }
+        else if (symbol >= '0' && symbol <= '8' && part != nullptr && !((*part >> (symbol - '0')) & 1))
+        {
+            *part |= 1 << (symbol - '0');
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    if (!survive_seen || (parsed.birth & 1))
+    {
+        return false;
+    }
+
+    rule = parsed;
+
+    return true;
+}
+
+/** @fn RuleName(const struct_rule &rule)
+ *  @brief The rule in the notation B3/S23.
+ */
+std::string RuleName(const struct_rule &rule)
+{
+    std::string name = "B";
+
+    for (int n = 0; n <= 8; n++)
+    {
+        if ((rule.birth >> n) & 1)
+        {
+            name += (char) ('0' + n);
+        }
+    }
+
+    name += "/S";
+
+    for (int n = 0; n <= 8; n++)
+    {
+        if ((rule.survive >> n) & 1)
+        {
+            name += (char) ('0' + n);
+        }
+    }
+
+    return name;
+}
+
+}
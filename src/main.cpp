@@ -1,5 +1,8 @@
 #include <stdio.h>
+#include <time.h>
 #include <chrono>
+#include <future>
+#include <memory>
 #include <thread>
 #include <cmath>
 #include <SFML/Graphics.hpp>
@@ -9,6 +12,15 @@
 #include "visual2d.hpp"
 #include "lifeCycle.hpp"
 #include "python_wrapper.hpp"
+#include "profiler.hpp"
+#include "batchRunner.hpp"
+#include "ruleExplorer.hpp"
+#include "controlServer.hpp"
+#include "historyLog.hpp"
+#include "domainDecomposition.hpp"
+#include "cellEditor.hpp"
+#include "census.hpp"
+#include "framePipeline.hpp"
 
 #include <unistd.h>
 
@@ -17,6 +29,23 @@ using namespace std;
 
 int main (int argc, char *argv[])
 {
+        // Duration of each startup phase, reported after the first generation. Many short runs are started, for
+        // them the time to the first generation matters.
+        typedef std::chrono::steady_clock startup_clock;
+        startup_clock::time_point startup_start = startup_clock::now(), startup_last = startup_start;
+        std::string startup_report;
+
+        auto startup_phase = [&](std::string phase)
+        {
+            startup_clock::time_point now = startup_clock::now();
+            char text[96];
+
+            snprintf(text, sizeof text, "%s%s %.1f ms", startup_report.empty() ? "" : ", ", phase.c_str(),
+                     std::chrono::duration<double, std::milli>(now - startup_last).count());
+            startup_report += text;
+            startup_last = now;
+        };
+
 	// Output of the program version.
 	fprintf(stdout,"%s -- Version %d.%d\n", GAME_PROJECT_NAME, GAME_VERSION_MAJOR, GAME_VERSION_MINOR);
 
@@ -29,21 +58,380 @@ int main (int argc, char *argv[])
 	SPFR::ReadConfig read_config(help_string);
 
         int number_of_elements = 100;
+        int board_rows = 0;
+        int board_columns = 0;
         int live_rate = 10;
+        int threads = 1;
+        std::string thread_pinning = "none";
         std::string window_form = "square";
         std::string initial_placement = "empty";
+        std::string step_mode = "active_tiles";
+        std::string kernel = "bitwise";
+        std::string rule = "B3/S23";
+        std::string on_cycle = "continue";
+        int cycle_window = 64;
+        int max_generations = 0;
+        std::string shared_memory_name = "none";
+        int shared_memory_slots = 4;
+        std::string control_socket = "none";
+        std::string control_start = "running";
+        std::string history_mode = "none";
+        std::string history_file = "/tmp/game_of_life.history";
+        int history_key_frame_interval = 100;
+        int replay_generation = 0;
+        int stats_interval = 32;
+        std::string stats_file = "none";
+        int distributed_ranks = 0;
+        int distributed_view_factor = 4;
+        std::string stamp_pattern = "none";
+        int python_plots = 0;
+        int census_interval = 0;
+        std::string census_file = "none";
+        int edge_margin = 0;
+        int cold_tile_generations = 0;
+        std::string huge_pages = "transparent";
+        int pipeline_depth = 0;
+        std::string color_mode = "grey";
 
         read_config.get_parameter("number_of_elements", number_of_elements);
         read_config.get_parameter("window_form", window_form);
         read_config.get_parameter("initial_placement", initial_placement);
+        read_config.get_parameter("board_rows", board_rows);
+        read_config.get_parameter("board_columns", board_columns);
         read_config.get_parameter("live_rate", live_rate);
+        read_config.get_parameter("threads", threads);
+        read_config.get_parameter("thread_pinning", thread_pinning);
+        read_config.get_parameter("step_mode", step_mode);
+        read_config.get_parameter("kernel", kernel);
+        read_config.get_parameter("rule", rule);
+        read_config.get_parameter("on_cycle", on_cycle);
+        read_config.get_parameter("cycle_window", cycle_window);
+        read_config.get_parameter("max_generations", max_generations);
+        read_config.get_parameter("shared_memory_name", shared_memory_name);
+        read_config.get_parameter("shared_memory_slots", shared_memory_slots);
+        read_config.get_parameter("control_socket", control_socket);
+        read_config.get_parameter("control_start", control_start);
+        read_config.get_parameter("history_mode", history_mode);
+        read_config.get_parameter("history_file", history_file);
+        read_config.get_parameter("history_key_frame_interval", history_key_frame_interval);
+        read_config.get_parameter("replay_generation", replay_generation);
+        read_config.get_parameter("stats_interval", stats_interval);
+        read_config.get_parameter("stats_file", stats_file);
+        read_config.get_parameter("distributed_ranks", distributed_ranks);
+        read_config.get_parameter("distributed_view_factor", distributed_view_factor);
+        read_config.get_parameter("stamp_pattern", stamp_pattern);
+        read_config.get_parameter("python_plots", python_plots);
+        read_config.get_parameter("census_interval", census_interval);
+        read_config.get_parameter("census_file", census_file);
+        read_config.get_parameter("edge_margin", edge_margin);
+        read_config.get_parameter("cold_tile_generations", cold_tile_generations);
+        read_config.get_parameter("huge_pages", huge_pages);
+        read_config.get_parameter("pipeline_depth", pipeline_depth);
+        read_config.get_parameter("color_mode", color_mode);
+
+        // Before the first buffer of the biotope is allocated.
+        GameOfLife::SetHugePages(huge_pages);
+
+        // Batch mode: many small biotopes without window and plots.
+        int batch_runs = 0;
+        read_config.get_parameter("batch_runs", batch_runs);
+
+        if (batch_runs > 0)
+        {
+            int batch_rows = 256;
+            int batch_columns = 256;
+            int batch_live_rate_min = live_rate;
+            int batch_live_rate_max = live_rate;
+            int batch_live_rate_step = 1;
+            int batch_seed = 1;
+            std::string batch_output = "";
+            int batch_multiverse = 0;
+
+            read_config.get_parameter("batch_rows", batch_rows);
+            read_config.get_parameter("batch_columns", batch_columns);
+            read_config.get_parameter("batch_live_rate_min", batch_live_rate_min);
+            read_config.get_parameter("batch_live_rate_max", batch_live_rate_max);
+            read_config.get_parameter("batch_live_rate_step", batch_live_rate_step);
+            read_config.get_parameter("batch_seed", batch_seed);
+            read_config.get_parameter("batch_output", batch_output);
+            read_config.get_parameter("batch_multiverse", batch_multiverse);
+
+            // Without a limit a chaotic biotope would never stop.
+            if (max_generations <= 0)
+            {
+                max_generations = 10000;
+                fprintf(stdout,"Batch runs need a limit, max_generations is set to %i.\n", max_generations);
+            }
+
+            GameOfLife::BatchRunner batch_runner(batch_rows, batch_columns, batch_runs, batch_live_rate_min,
+                                                 batch_live_rate_max, batch_live_rate_step, rule);
+
+            batch_runner.EnableMultiverse(batch_multiverse);
+            batch_runner.Run(threads, max_generations, cycle_window, batch_seed);
+            batch_runner.Report(batch_output);
+
+            return 0;
+        }
+
+        // Exploration mode: families of rules on the same soup without window and plots.
+        std::string explore_rules = "none";
+        read_config.get_parameter("explore_rules", explore_rules);
+
+        if (explore_rules != "none")
+        {
+            int explore_rows = 256;
+            int explore_columns = 256;
+            int explore_soup = 32;
+            int explore_seed = 1;
+            int explore_top = 20;
+            std::string explore_output = "";
+
+            read_config.get_parameter("explore_rows", explore_rows);
+            read_config.get_parameter("explore_columns", explore_columns);
+            read_config.get_parameter("explore_soup", explore_soup);
+            read_config.get_parameter("explore_seed", explore_seed);
+            read_config.get_parameter("explore_top", explore_top);
+            read_config.get_parameter("explore_output", explore_output);
+
+            // Chaotic rules never stop by themselves.
+            if (max_generations <= 0)
+            {
+                max_generations = 1000;
+                fprintf(stdout,"The exploration needs a limit, max_generations is set to %i.\n", max_generations);
+            }
+
+            GameOfLife::RuleExplorer explorer(explore_rows, explore_columns, explore_soup, live_rate, explore_seed);
+
+            if (explorer.AddRules(explore_rules) == 0)
+            {
+                fprintf(stdout,"There is no rule to explore in: %s.\n", explore_rules.c_str());
+                return 0;
+            }
+
+            explorer.Run(threads, max_generations, cycle_window);
+            explorer.Report(explore_top, explore_output);
+
+            return 0;
+        }
+
+        startup_phase("config");
 
 	// Starting the 2D visualization.
 	GameOfLife::Visual2D visualization(number_of_elements, window_form);
+
+        startup_phase("screen");
 	
-	// Start the Cycle of Life.
-        GameOfLife::LifeCycle lifecycle(visualization.rows, visualization.columns, 
-                                        visualization.res_num_elements, initial_placement, " ", live_rate);
+        // Replay of a recorded run instead of the simulation. The log knows the size of the biotope.
+        std::unique_ptr<GameOfLife::HistoryReplay> replay;
+        bool replay_playing = false;
+
+        if (history_mode == "replay")
+        {
+            replay.reset(new GameOfLife::HistoryReplay(history_file));
+
+            if (replay->IsOpen())
+            {
+                board_rows = replay->Rows();
+                board_columns = replay->Columns();
+            }
+            else
+            {
+                fprintf(stdout,"The program will continue with the simulation.\n");
+                replay.reset();
+            }
+        }
+
+        // Without an explicit size, the biotope gets the size of the grid on the screen.
+        if (board_rows <= 0 || board_columns <= 0)
+        {
+            board_rows = visualization.rows;
+            board_columns = visualization.columns;
+        }
+
+        // Distributed mode: the biotope lives in several processes, the window shows a downsampled view of it. The
+        // ranks are forked before any thread of this process is started.
+        std::unique_ptr<GameOfLife::DomainDecomposition> decomposition;
+
+        if (distributed_ranks > 0 && !replay)
+        {
+            decomposition.reset(new GameOfLife::DomainDecomposition(board_rows, board_columns, distributed_ranks,
+                                                                    distributed_view_factor));
+
+            unsigned seed = time(NULL);
+
+            bool started = decomposition->Start([&](GameOfLife::LifeCycle &block_lifecycle,
+                                                    const GameOfLife::struct_block &block)
+            {
+                block_lifecycle.SetThreads(threads);
+                block_lifecycle.SetStepMode(step_mode);
+                block_lifecycle.SetKernel(kernel);
+                block_lifecycle.SetRule(rule);
+                block_lifecycle.SetSeed(seed + 7919 * block.rank);
+                block_lifecycle.EnableColdTiles(cold_tile_generations);
+
+                if (initial_placement == "random")
+                {
+                    block_lifecycle.RandomPatternGenerator();
+                }
+            });
+
+            if (started)
+            {
+                board_rows = decomposition->ViewRows();
+                board_columns = decomposition->ViewColumns();
+            }
+            else
+            {
+                fprintf(stdout,"The program will continue with a single process.\n");
+                decomposition.reset();
+            }
+        }
+
+        startup_phase("setup");
+
+	// Start the Cycle of Life. The biotope is allocated and seeded in the background, while the window is created.
+        // The ranks of the distributed mode are forked already.
+        double biotope_milliseconds = 0.0;
+
+        std::future<std::unique_ptr<GameOfLife::LifeCycle>> biotope = std::async(std::launch::async, [&]()
+        {
+            startup_clock::time_point start = startup_clock::now();
+
+            std::unique_ptr<GameOfLife::LifeCycle> created(
+                new GameOfLife::LifeCycle(board_rows, board_columns, board_rows * board_columns,
+                                          replay || decomposition ? "empty" : initial_placement, " ", live_rate));
+
+            biotope_milliseconds = std::chrono::duration<double, std::milli>(startup_clock::now() - start).count();
+
+            return created;
+        });
+
+        // Set the size and other parameter of the window.
+        sf::RenderWindow window(sf::VideoMode(visualization.window_width, visualization.window_height), 
+                                "Game_of_Life", sf::Style::Close);
+
+        // Sets the position of the window on the screen.
+        window.setPosition(sf::Vector2i(visualization.window_posx, visualization.window_posy));
+
+        startup_phase("window");
+
+        std::unique_ptr<GameOfLife::LifeCycle> lifecycle_owner = biotope.get();
+        GameOfLife::LifeCycle &lifecycle = *lifecycle_owner;
+
+        startup_phase("wait for the biotope");
+        startup_report += " (biotope " + std::to_string((int) round(biotope_milliseconds)) + " ms)";
+
+        lifecycle.SetThreads(threads, thread_pinning);
+        lifecycle.SetStepMode(step_mode);
+        lifecycle.SetKernel(kernel);
+        lifecycle.SetRule(rule);
+
+        if (step_mode == "adaptive" || stats_file != "none")
+        {
+            lifecycle.SetStats(stats_interval, stats_file != "none" ? stats_file : "");
+        }
+
+        lifecycle.SetCycleDetection(on_cycle, cycle_window);
+        lifecycle.SetMaxGenerations(max_generations);
+
+        if (shared_memory_name != "none")
+        {
+            lifecycle.EnableSharedExport(shared_memory_name, shared_memory_slots);
+        }
+
+        if (replay)
+        {
+            replay->Seek(replay_generation, lifecycle);
+        }
+        else if (decomposition)
+        {
+            decomposition->Gather(lifecycle);
+        }
+        else if (history_mode == "record")
+        {
+            lifecycle.EnableHistory(history_file, history_key_frame_interval);
+        }
+
+        // The blocks of the distributed mode pass the spaceships on to each other, the view never steps.
+        if (!decomposition && !replay && edge_margin > 0)
+        {
+            lifecycle.EnableEdgeMonitor(edge_margin);
+        }
+
+        // Tiles of the ash, which do not change any more, are compressed. The view of the distributed mode and a
+        // replay never step.
+        if (!decomposition && !replay)
+        {
+            lifecycle.EnableColdTiles(cold_tile_generations);
+        }
+
+        // Ages of the individuals for the colors. Only a life cycle, which steps itself, knows them.
+        if (color_mode == "age" && (decomposition || replay))
+        {
+            fprintf(stdout,"The ages of the individuals are not known in a replay or the distributed mode.\n");
+            color_mode = "grey";
+        }
+        else if (color_mode == "age")
+        {
+            lifecycle.EnableCellAges(true);
+        }
+
+        if (color_mode != "grey")
+        {
+            visualization.SetColorMode(color_mode);
+        }
+
+        // Census of the objects. The view of the distributed mode is downsampled, its objects mean nothing.
+        if (!decomposition && (census_interval > 0 || census_file != "none"))
+        {
+            lifecycle.EnableCensus(census_interval, census_file != "none" ? census_file : "");
+        }
+
+        // Remote control: other programs pause, step, edit and watch the biotope over a local socket.
+        std::unique_ptr<GameOfLife::ControlServer> control_server;
+
+        if (control_socket != "none" && decomposition)
+        {
+            fprintf(stdout,"The remote control is not available in the distributed mode.\n");
+        }
+        else if (control_socket != "none")
+        {
+            control_server.reset(new GameOfLife::ControlServer(control_socket, control_start == "paused"));
+
+            if (!control_server->IsOpen())
+            {
+                control_server.reset();
+            }
+        }
+
+        // Painting and stamping with the mouse. A replay and the view of the distributed mode cannot be edited.
+        std::unique_ptr<GameOfLife::CellEditor> editor;
+
+        if (!replay && !decomposition)
+        {
+            editor.reset(new GameOfLife::CellEditor(stamp_pattern));
+        }
+
+        // Frame pipeline: the biotope is stepped on its own thread and the window shows a view of it. A replay, the
+        // distributed mode and the remote control step the biotope from the window thread.
+        std::unique_ptr<GameOfLife::LifeCycle> view_owner;
+        std::unique_ptr<GameOfLife::FramePipeline> pipeline;
+
+        if (pipeline_depth > 0 && (replay || decomposition || control_server))
+        {
+            fprintf(stdout,"The frame pipeline is not available with a replay, the distributed mode or a remote "
+                    "control.\n");
+        }
+        else if (pipeline_depth > 0)
+        {
+            view_owner.reset(new GameOfLife::LifeCycle(board_rows, board_columns, board_rows * board_columns, "empty",
+                                                       " ", live_rate, false));
+            view_owner->EnableCellAges(lifecycle.CellAgesEnabled());
+            pipeline.reset(new GameOfLife::FramePipeline(lifecycle, *view_owner, pipeline_depth));
+        }
+
+        // The biotope on the screen. With the pipeline, the life cycle itself belongs to the stepping thread.
+        GameOfLife::LifeCycle &shown = pipeline ? *view_owner : lifecycle;
 
 	// Frequency control and execution time calculation.
 	// Parameter. This will go into the configuration file later.
@@ -69,19 +457,42 @@ int main (int argc, char *argv[])
 
 	int iter_fps_calc = 0;
 	int iter_exe_calc = 0;
-	
-        // Set the size and other parameter of the window.
-        sf::RenderWindow window(sf::VideoMode(visualization.window_width, visualization.window_height), 
-                                "Game_of_Life", sf::Style::Close);
 
-    
-        // Sets the position of the window on the screen.
-        window.setPosition(sf::Vector2i(visualization.window_posx, visualization.window_posy));
-        
-        // Call the Python wrapper method to plot some statistics.
-        GameOfLife::PythonWrapper pythonwrapper(8);
-        
+        // Hot path trace. Only available, if the program was built with the CMake option GAME_ENABLE_PROFILING.
+        std::string trace_file = "none";
+        int trace_flush_interval = 100;
+
+        read_config.get_parameter("trace_file", trace_file);
+        read_config.get_parameter("trace_flush_interval", trace_flush_interval);
+
+        bool tracing = !trace_file.empty() && trace_file != "none";
+
+#ifdef GAME_ENABLE_PROFILING
+        int iter_trace_flush = 0;
+
+        if (tracing)
+        {
+            GameOfLife::Profiler::Instance().Open(trace_file);
+        }
+#else
+        if (tracing)
+        {
+            fprintf(stdout,"The program was built without GAME_ENABLE_PROFILING. No trace will be written.\n");
+        }
+#endif
+
+        // The Python interpreter is only started, if statistics are plotted.
+        std::unique_ptr<GameOfLife::PythonWrapper> pythonwrapper;
+
+        if (python_plots > 0)
+        {
+            pythonwrapper.reset(new GameOfLife::PythonWrapper(8));
+        }
+
+        startup_phase("settings");
+
         sf::Event event;
+        bool first_frame_shown = false, startup_reported = false;
                 
         bool initialization = true;
         
@@ -100,10 +511,67 @@ int main (int argc, char *argv[])
             fps_counter_start = std::chrono::system_clock::now();
             execution_time_start = std::chrono::high_resolution_clock::now();
 
+            // Commands of the remote control, which can step the biotope on their own.
+            if (control_server)
+            {
+                control_server->Poll(lifecycle);
+            }
+
+            // The edits of the last frame, as one batch between two generations.
+            if (editor && pipeline)
+            {
+                pipeline->SubmitEdits(editor->TakeEdits());
+            }
+            else if (editor)
+            {
+                editor->Apply(lifecycle);
+            }
+
             // Each iteration is one life cycle, but not in the first iteration.
             if (!initialization)
             {
-                lifecycle.LifeRules();
+                if (replay)
+                {
+                    if (replay_playing && replay->Position() + 1 < replay->Records())
+                    {
+                        GOL_PROFILE_SCOPE("Replay");
+                        replay->SeekRecord(replay->Position() + 1, lifecycle);
+                    }
+                }
+                else if (decomposition)
+                {
+                    GOL_PROFILE_SCOPE("DistributedStep");
+
+                    if (!decomposition->Step(1) || !decomposition->Gather(lifecycle))
+                    {
+                        window.close();
+                    }
+                }
+                else if (pipeline)
+                {
+                    GOL_PROFILE_SCOPE("NextFrame");
+                    pipeline->NextFrame();
+                }
+                else if (!control_server || control_server->Running())
+                {
+                    GOL_PROFILE_SCOPE("LifeRules");
+                    lifecycle.LifeRules();
+
+                    if (control_server)
+                    {
+                        control_server->Broadcast(lifecycle);
+                    }
+                }
+
+                if (!startup_reported)
+                {
+                    startup_phase("first generation");
+                    startup_reported = true;
+
+                    fprintf(stdout,"\nStartup in %.1f ms: %s.\n",
+                            std::chrono::duration<double, std::milli>(startup_last - startup_start).count(),
+                            startup_report.c_str());
+                }
             }
             else
             {
@@ -111,20 +579,82 @@ int main (int argc, char *argv[])
             }
 
             // Re-draw the scenery.
-            visualization.GridUpdater(lifecycle.individuals);
+            {
+                GOL_PROFILE_SCOPE("GridUpdater");
+                visualization.GridUpdater(shown);
+            }
 		
-            while (window.pollEvent(event))
             {
-                   if (event.type == sf::Event::Closed || event.key.code == sf::Keyboard::Escape) 
-                   {
-                       window.close();
-                   }
+                GOL_PROFILE_SCOPE("pollEvent");
+
+                while (window.pollEvent(event))
+                {
+                       if (event.type == sf::Event::Closed || 
+                           (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)) 
+                       {
+                           window.close();
+                       }
+                       else if (replay && event.type == sf::Event::KeyPressed)
+                       {
+                           // Replay controls, all other keys move the camera.
+                           size_t position = replay->Position();
+                           uint64_t generation = replay->RecordGeneration(position);
+                           uint64_t jump = replay->KeyFrameInterval();
+
+                           switch(event.key.code)
+                           {
+                               case sf::Keyboard::Space :
+                                   replay_playing = !replay_playing;
+                                   break;
+                               case sf::Keyboard::Period :
+                                   replay->SeekRecord(position + 1, lifecycle);
+                                   break;
+                               case sf::Keyboard::Comma :
+                                   if (position > 0) replay->SeekRecord(position - 1, lifecycle);
+                                   break;
+                               case sf::Keyboard::PageDown :
+                                   replay->Seek(generation + jump, lifecycle);
+                                   break;
+                               case sf::Keyboard::PageUp :
+                                   replay->Seek(generation > jump ? generation - jump : 0, lifecycle);
+                                   break;
+                               case sf::Keyboard::End :
+                                   replay->SeekRecord(replay->Records() - 1, lifecycle);
+                                   break;
+                               default:
+                                   visualization.HandleEvent(event);
+                                   break;
+                           }
+                       }
+                       else if (!replay && !decomposition && event.type == sf::Event::KeyPressed &&
+                                event.key.code == sf::Keyboard::C)
+                       {
+                           shown.TakeCensus().Report(10);
+                       }
+                       else if (!editor || !editor->HandleEvent(event, visualization))
+                       {
+                           visualization.HandleEvent(event);
+                       }
+                }
             }
         
             // Grey background
-            window.clear(sf::Color(128,128,128));
-            window.draw(visualization.biotope_map);
-            window.display();
+            {
+                GOL_PROFILE_SCOPE("draw");
+                window.clear(sf::Color(128,128,128));
+                window.draw(visualization.biotope_sprite);
+            }
+
+            {
+                GOL_PROFILE_SCOPE("display");
+                window.display();
+            }
+
+            if (!first_frame_shown)
+            {
+                startup_phase("first frame");
+                first_frame_shown = true;
+            }
             
             // Save the window content to a file.
             /*iter++;
@@ -159,7 +689,20 @@ int main (int argc, char *argv[])
 
             // Sleep function to control the frequency in the program.
             fps_counter_end = fps_counter_start + std::chrono::microseconds(fps_in_us);
-            this_thread::sleep_until(fps_counter_end);
+
+            {
+                GOL_PROFILE_SCOPE("sleep");
+                this_thread::sleep_until(fps_counter_end);
+            }
+
+#ifdef GAME_ENABLE_PROFILING
+            // Export the collected samples from time to time, so that the buffers do not overflow.
+            if (++iter_trace_flush >= trace_flush_interval)
+            {
+                iter_trace_flush = 0;
+                GameOfLife::Profiler::Instance().Flush();
+            }
+#endif
 
             // Calculation of the FPS average. Just to check, if the "sleep_until" mechanism is working.
             fps_array[iter_fps_calc] = std::chrono::duration_cast<std::chrono::microseconds>( std::chrono::system_clock::now() -
@@ -187,5 +730,14 @@ int main (int argc, char *argv[])
             }
         }
 
+        if (pipeline)
+        {
+            pipeline->Report();
+        }
+
+#ifdef GAME_ENABLE_PROFILING
+        GameOfLife::Profiler::Instance().Close();
+#endif
+
 	return 0;
 }
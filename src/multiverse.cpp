@@ -0,0 +1,423 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    multiverse.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Up to 256 independent biotopes of the same size, stepped together bit-sliced.
+ *
+ * This program part steps the universes, moves them from and to life cycles and counts their populations.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <utility>
+
+#include "multiverse.hpp"
+
+
+namespace GameOfLife
+{
+
+/** @fn Transpose64(uint64_t *block)
+ *  @brief Transposes a matrix of 64 x 64 bits in place: bit k of word i becomes bit i of word k.
+ *
+ *  Six rounds swap the off-diagonal blocks of 32, 16, ..., 1 bits.
+ */
+static void Transpose64(uint64_t *block)
+{
+    uint64_t mask = 0x00000000ffffffffULL;
+
+    for (int width = 32; width != 0; width >>= 1, mask ^= mask << width)
+    {
+        for (int start = 0; start < 64; start += 2 * width)
+        {
+            for (int i = start; i < start + width; i++)
+            {
+                uint64_t swap = ((block[i] >> width) ^ block[i + width]) & mask;
+
+                block[i] ^= swap << width;
+                block[i + width] ^= swap;
+            }
+        }
+    }
+}
+
+// Generator of the CRC in Multiverse::Hashes(), x^64 + x^54 + x^53 + x^49 + x^39 + x^38 + x^36 + x^16 + x^10 + x^9 + 1.
+static constexpr int crc_taps[] = {9, 10, 16, 36, 38, 39, 49, 53, 54};
+
+/** @fn CrcStep(uint64_t *shift_register, uint64_t word)
+ *  @brief Shifts one word of 64 universes into the bit-sliced shift register of a CRC.
+ *
+ *  The register is a ring, the coefficient of x^j is at head + j, so a shift only moves the head. After Step shifts
+ *  of a block of 64, the head is at 64 - Step, which is a constant here.
+ */
+template<int Step>
+static inline void CrcStep(uint64_t *shift_register, uint64_t word)
+{
+    constexpr int head = (64 - Step) & 63;
+
+    uint64_t feedback = shift_register[head] ^ word;
+    shift_register[head] = feedback;
+
+    for (int tap : crc_taps)
+    {
+        shift_register[(head + tap) & 63] ^= feedback;
+    }
+}
+
+/** @fn CrcBlock(uint64_t *shift_register, const uint64_t *words, int stride, std::integer_sequence<int, Steps...>)
+ *  @brief Shifts 64 words, one every stride words, into the shift register, which then has its head at 0 again.
+ */
+template<int... Steps>
+static inline void CrcBlock(uint64_t *shift_register, const uint64_t *words, int stride,
+                            std::integer_sequence<int, Steps...>)
+{
+    (CrcStep<Steps + 1>(shift_register, words[(size_t) Steps * stride]), ...);
+}
+
+/** @fn Multiverse::Multiverse(int rows, int columns, int universes, const struct_rule &rule, int threads)
+ *  @brief Constructor of the class Multiverse. All universes start empty.
+ */
+Multiverse::Multiverse(int rows, int columns, int universes, const struct_rule &rule, int threads)
+{
+    if (universes < 1 || universes > max_universes)
+    {
+        fprintf(stdout,"A multiverse holds 1 to %i universes, not %i. The program will continue with %i.\n",
+                max_universes, universes, std::min(std::max(universes, 1), max_universes));
+
+        universes = std::min(std::max(universes, 1), max_universes);
+    }
+
+    this->_rows = rows;
+    this->_columns = columns;
+    this->_universes = universes;
+    this->_rule = rule;
+
+    // 1, 2 or 4 words per position.
+    this->_lanes = universes <= 64 ? 1 : universes <= 128 ? 2 : 4;
+
+    this->_cells[0].assign((size_t) (rows + 2) * (columns + 2) * _lanes, 0);
+    this->_cells[1].assign((size_t) (rows + 2) * (columns + 2) * _lanes, 0);
+    this->_front = 0;
+    this->_generation = 0;
+
+    this->_row_changed.assign((size_t) rows * _lanes, 0);
+    this->_changed.assign(_lanes, 0);
+
+    if (threads > 1)
+    {
+        _pool.reset(new WorkerPool(threads));
+    }
+}
+
+/** @fn Multiverse::~Multiverse()
+ *  @brief Destructor of the class Multiverse.
+ *
+ */
+Multiverse::~Multiverse()
+{
+}
+
+/** @fn Multiverse::Load(int universe, const LifeCycle &lifecycle)
+ *  @brief Replaces the individuals of one universe by the ones of the life cycle.
+ */
+void Multiverse::Load(int universe, const LifeCycle &lifecycle)
+{
+    if (universe < 0 || universe >= _universes || lifecycle.Rows() != _rows || lifecycle.Columns() != _columns)
+    {
+        return;
+    }
+
+    int lane = universe / 64;
+    uint64_t bit = 1ULL << (universe % 64);
+
+    for (int row = 0; row < _rows; row++)
+    {
+        for (int column = 0; column < _columns; column += tile_size)
+        {
+            uint64_t word = lifecycle.TileRow(lifecycle.TileSlot(row / tile_size, column / tile_size),
+                                              row % tile_size);
+
+            for (int c = 0; c < tile_size && column + c < _columns; c++)
+            {
+                uint64_t &cell = _cells[_front][this->Position(row, column + c) + lane];
+
+                cell = (word >> c) & 1 ? cell | bit : cell & ~bit;
+            }
+        }
+    }
+}
+
+/** @fn Multiverse::Store(int universe, LifeCycle &lifecycle)
+ *  @brief Copies one universe into a life cycle with the same size.
+ */
+void Multiverse::Store(int universe, LifeCycle &lifecycle) const
+{
+    if (universe < 0 || universe >= _universes || lifecycle.Rows() != _rows || lifecycle.Columns() != _columns)
+    {
+        return;
+    }
+
+    std::vector<struct_cell_change> individuals;
+
+    for (int row = 0; row < _rows; row++)
+    {
+        for (int column = 0; column < _columns; column++)
+        {
+            if (this->IsAlive(universe, row, column))
+            {
+                individuals.push_back({row, column, true});
+            }
+        }
+    }
+
+    lifecycle.Restart(individuals);
+}
+
+/** @fn Multiverse::Step(int generations)
+ *  @brief Calculates the next generations of all universes.
+ */
+void Multiverse::Step(int generations)
+{
+    bool conway = _rule == conway_rule;
+
+    for (int i = 0; i < generations; i++)
+    {
+        auto step_rows = [this, conway](int begin, int end, int worker)
+        {
+            switch((_lanes << 1) | conway)
+            {
+                case (1 << 1) | 1 : this->StepRows<1, true>(begin, end); break;
+                case (2 << 1) | 1 : this->StepRows<2, true>(begin, end); break;
+                case (4 << 1) | 1 : this->StepRows<4, true>(begin, end); break;
+                case (1 << 1) : this->StepRows<1, false>(begin, end); break;
+                case (2 << 1) : this->StepRows<2, false>(begin, end); break;
+                default : this->StepRows<4, false>(begin, end); break;
+            }
+        };
+
+        if (_pool)
+        {
+            _pool->ParallelFor(_rows, 16, step_rows);
+        }
+        else
+        {
+            step_rows(0, _rows, 0);
+        }
+
+        _front ^= 1;
+        _generation++;
+
+        std::fill(_changed.begin(), _changed.end(), 0);
+
+        for (int row = 0; row < _rows; row++)
+        {
+            for (int lane = 0; lane < _lanes; lane++)
+            {
+                _changed[lane] |= _row_changed[(size_t) row * _lanes + lane];
+            }
+        }
+    }
+}
+
+/** @fn Multiverse::StepRows(int begin, int end)
+ *  @brief Calculates the next generation of the rows [begin, end) of all universes.
+ *
+ *  Each column of three individuals is summed up once into 2 bits and then used by the three positions next to it.
+ *  The three column sums give the count of the 3 x 3 block with the individual itself, 4 bits per universe, so the
+ *  rule is applied with the survivals shifted by one.
+ */
+template<int Lanes, bool Conway>
+void Multiverse::StepRows(int begin, int end)
+{
+    using ConwayBlockRule = LifeRule<ConwayRule::birth, ConwayRule::survive << 1>;
+    const struct_rule block_rule = {_rule.birth, (uint16_t) (_rule.survive << 1)};
+
+    const uint64_t *current = _cells[_front].data();
+    uint64_t *next = _cells[_front ^ 1].data();
+
+    const size_t row_stride = (size_t) (_columns + 2) * Lanes;
+
+    for (int row = begin; row < end; row++)
+    {
+        uint64_t changed[Lanes] = {};
+
+        // Column sums of the left, middle and right column: low and high bit. Left of column 0 is the frame.
+        uint64_t left_low[Lanes] = {}, left_high[Lanes] = {}, middle_low[Lanes], middle_high[Lanes];
+
+        const uint64_t *first = &current[this->Position(row, 0)];
+
+        for (int lane = 0; lane < Lanes; lane++)
+        {
+            uint64_t above = first[lane - row_stride], middle = first[lane], below = first[lane + row_stride];
+
+            middle_low[lane] = above ^ middle ^ below;
+            middle_high[lane] = (above & middle) | (below & (above ^ middle));
+        }
+
+        for (int column = 0; column < _columns; column++)
+        {
+            const uint64_t *centre = &current[this->Position(row, column)];
+            const uint64_t *right = centre + Lanes;
+            uint64_t *result = &next[this->Position(row, column)];
+
+            for (int lane = 0; lane < Lanes; lane++)
+            {
+                uint64_t above = right[lane - row_stride], middle = right[lane], below = right[lane + row_stride];
+
+                uint64_t right_low = above ^ middle ^ below;
+                uint64_t right_high = (above & middle) | (below & (above ^ middle));
+
+                // Sum of the three column sums: ones, twos, fours and eights.
+                uint64_t ones = left_low[lane] ^ middle_low[lane] ^ right_low;
+                uint64_t carry = (left_low[lane] & middle_low[lane]) |
+                                 (right_low & (left_low[lane] ^ middle_low[lane]));
+
+                uint64_t pairs = left_high[lane] ^ middle_high[lane] ^ right_high;
+                uint64_t pairs_carry = (left_high[lane] & middle_high[lane]) |
+                                       (right_high & (left_high[lane] ^ middle_high[lane]));
+
+                uint64_t twos = pairs ^ carry;
+                uint64_t fours = pairs_carry ^ (pairs & carry);
+                uint64_t eights = pairs_carry & pairs & carry;
+
+                if constexpr (Conway)
+                {
+                    result[lane] = ApplyRule<ConwayBlockRule>(centre[lane], ones, twos, fours, eights);
+                }
+                else
+                {
+                    result[lane] = ApplyRule(block_rule, centre[lane], ones, twos, fours, eights);
+                }
+
+                changed[lane] |= result[lane] ^ centre[lane];
+
+                left_low[lane] = middle_low[lane];
+                left_high[lane] = middle_high[lane];
+                middle_low[lane] = right_low;
+                middle_high[lane] = right_high;
+            }
+        }
+
+        for (int lane = 0; lane < Lanes; lane++)
+        {
+            _row_changed[(size_t) row * Lanes + lane] = changed[lane];
+        }
+    }
+}
+
+/** @fn Multiverse::Population(int universe)
+ *  @brief Number of living individuals of one universe.
+ */
+uint64_t Multiverse::Population(int universe) const
+{
+    if (universe < 0 || universe >= _universes)
+    {
+        return 0;
+    }
+
+    const board_vector<uint64_t> &cells = _cells[_front];
+    uint64_t population = 0;
+
+    for (size_t word = universe / 64; word < cells.size(); word += _lanes)
+    {
+        population += (cells[word] >> (universe % 64)) & 1;
+    }
+
+    return population;
+}
+
+/** @fn Multiverse::Populations(std::vector<uint64_t> &populations)
+ *  @brief Number of living individuals of every universe, with one pass over the board.
+ */
+void Multiverse::Populations(std::vector<uint64_t> &populations) const
+{
+    populations.assign((size_t) _lanes * 64, 0);
+
+    // The frame is dead, so the blocks of 64 words simply run over the whole buffer, lane by lane.
+    const board_vector<uint64_t> &cells = _cells[_front];
+    size_t positions = cells.size() / _lanes;
+    uint64_t block[64];
+
+    for (int lane = 0; lane < _lanes; lane++)
+    {
+        for (size_t first = 0; first < positions; first += 64)
+        {
+            for (int i = 0; i < 64; i++)
+            {
+                block[i] = first + i < positions ? cells[(first + i) * _lanes + lane] : 0;
+            }
+
+            Transpose64(block);
+
+            for (int k = 0; k < 64; k++)
+            {
+                populations[lane * 64 + k] += __builtin_popcountll(block[k]);
+            }
+        }
+    }
+
+    populations.resize(_universes);
+}
+
+/** @fn Multiverse::Hashes(std::vector<uint64_t> &hashes)
+ *  @brief Hash of every universe for the cycle detection, with one pass over the board.
+ *
+ *  The hash is the CRC of the individuals of a universe, position by position, with the primitive generator of
+ *  crc_taps. The 64 bits of the shift register are words as well, bit k for universe k, so the pass needs a few XORs
+ *  per position and only the register is transposed at the end. An empty universe has the hash 0.
+ */
+void Multiverse::Hashes(std::vector<uint64_t> &hashes) const
+{
+    hashes.resize((size_t) _lanes * 64);
+
+    const board_vector<uint64_t> &cells = _cells[_front];
+    size_t positions = cells.size() / _lanes;
+    uint64_t shift_register[64];
+
+    for (int lane = 0; lane < _lanes; lane++)
+    {
+        std::fill(shift_register, shift_register + 64, 0);
+
+        // Whole blocks of 64 positions, then the rest filled up with dead positions, which only shift the register.
+        for (size_t first = 0; first < positions; first += 64)
+        {
+            const uint64_t *words = &cells[first * _lanes + lane];
+
+            if (first + 64 <= positions)
+            {
+                CrcBlock(shift_register, words, _lanes, std::make_integer_sequence<int, 64>());
+            }
+            else
+            {
+                uint64_t rest[64] = {};
+
+                for (size_t i = 0; first + i < positions; i++)
+                {
+                    rest[i] = words[i * _lanes];
+                }
+
+                CrcBlock(shift_register, rest, 1, std::make_integer_sequence<int, 64>());
+            }
+        }
+
+        Transpose64(shift_register);
+        std::copy(shift_register, shift_register + 64, hashes.begin() + lane * 64);
+    }
+
+    hashes.resize(_universes);
+}
+
+bool Multiverse::IsAlive(int universe, int row, int column) const
+{
+    return (_cells[_front][this->Position(row, column) + universe / 64] >> (universe % 64)) & 1;
+}
+
+}
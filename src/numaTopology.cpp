@@ -0,0 +1,235 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    numaTopology.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   NUMA nodes and CPUs of the machine, and the CPU of each worker thread.
+ *
+ * This program part parses the CPU lists of the kernel and orders the CPUs after the pinning policy.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <fstream>
+
+#include "numaTopology.hpp"
+
+
+namespace GameOfLife
+{
+/** @fn ParseCpuList(std::string text)
+ *  @brief Reads a CPU list of the kernel like "0-3,8,10-11".
+ */
+static std::vector<int> ParseCpuList(std::string text)
+{
+    std::vector<int> cpus;
+    size_t position = 0;
+
+    while (position < text.size())
+    {
+        size_t end = text.find(',', position);
+
+        if (end == std::string::npos)
+        {
+            end = text.size();
+        }
+
+        std::string range = text.substr(position, end - position);
+        int first, last;
+
+        if (sscanf(range.c_str(), "%d-%d", &first, &last) == 2)
+        {
+            for (int cpu = first; cpu <= last; cpu++)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+        else if (sscanf(range.c_str(), "%d", &first) == 1)
+        {
+            cpus.push_back(first);
+        }
+
+        position = end + 1;
+    }
+
+    return cpus;
+}
+
+/** @fn FormatCpuList(const std::vector<int> &cpus)
+ *  @brief Writes sorted CPUs as ranges again, the opposite of ParseCpuList().
+ */
+static std::string FormatCpuList(const std::vector<int> &cpus)
+{
+    std::string text;
+
+    for (size_t i = 0; i < cpus.size(); )
+    {
+        size_t j = i;
+
+        while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1)
+        {
+            j++;
+        }
+
+        text += (text.empty() ? "" : ",") + std::to_string(cpus[i]);
+
+        if (j > i)
+        {
+            text += "-" + std::to_string(cpus[j]);
+        }
+
+        i = j + 1;
+    }
+
+    return text;
+}
+
+/** @fn NumaTopology::NumaTopology()
+ *  @brief Constructor of the class NumaTopology.
+ *
+ *  Only the CPUs of the affinity mask of the process are taken into account.
+ */
+NumaTopology::NumaTopology()
+{
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+
+    bool affinity = sched_getaffinity(0, sizeof allowed, &allowed) == 0;
+
+    for (int node = 0; ; node++)
+    {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        std::string text;
+
+        if (!file || !std::getline(file, text))
+        {
+            break;
+        }
+
+        std::vector<int> cpus;
+
+        for (int cpu : ParseCpuList(text))
+        {
+            if (cpu < CPU_SETSIZE && (!affinity || CPU_ISSET(cpu, &allowed)))
+            {
+                cpus.push_back(cpu);
+            }
+        }
+
+        // A node without usable CPUs can still have memory, but no thread runs there.
+        if (!cpus.empty())
+        {
+            _node_cpus.push_back(cpus);
+        }
+    }
+
+    if (_node_cpus.empty())
+    {
+        std::vector<int> cpus;
+
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            if (affinity ? CPU_ISSET(cpu, &allowed) : cpu == 0)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+
+        _node_cpus.push_back(cpus);
+    }
+}
+
+/** @fn NumaTopology::~NumaTopology()
+ *  @brief Destructor of the class NumaTopology.
+ *
+ */
+NumaTopology::~NumaTopology()
+{
+
+}
+
+/** @fn NumaTopology::PinOrder(std::string policy, int threads)
+ *  @brief Chooses a CPU for every thread. With more threads than CPUs, the CPUs are used again.
+ */
+std::vector<int> NumaTopology::PinOrder(std::string policy, int threads) const
+{
+    std::vector<int> order;
+
+    if (policy == "compact")
+    {
+        for (const std::vector<int> &cpus : _node_cpus)
+        {
+            order.insert(order.end(), cpus.begin(), cpus.end());
+        }
+    }
+    else if (policy == "scatter")
+    {
+        for (size_t index = 0; order.size() < threads && index < (size_t) CPU_SETSIZE; index++)
+        {
+            for (const std::vector<int> &cpus : _node_cpus)
+            {
+                if (index < cpus.size())
+                {
+                    order.push_back(cpus[index]);
+                }
+            }
+        }
+    }
+    else
+    {
+        if (policy != "none")
+        {
+            fprintf(stdout,"The pinning policy %s is not known, the threads are not pinned.\n", policy.c_str());
+        }
+
+        return order;
+    }
+
+    std::vector<int> pins;
+
+    for (int thread = 0; thread < threads && !order.empty(); thread++)
+    {
+        pins.push_back(order[thread % order.size()]);
+    }
+
+    return pins;
+}
+
+/** @fn NumaTopology::NodeOfCpu(int cpu)
+ *  @brief Node of a CPU, -1 if the CPU is not usable.
+ */
+int NumaTopology::NodeOfCpu(int cpu) const
+{
+    for (int node = 0; node < _node_cpus.size(); node++)
+    {
+        if (std::find(_node_cpus[node].begin(), _node_cpus[node].end(), cpu) != _node_cpus[node].end())
+        {
+            return node;
+        }
+    }
+
+    return -1;
+}
+
+std::string NumaTopology::Describe() const
+{
+    std::string text = std::to_string(_node_cpus.size()) + (_node_cpus.size() == 1 ? " NUMA node: " : " NUMA nodes: ");
+
+    for (size_t node = 0; node < _node_cpus.size(); node++)
+    {
+        text += (node > 0 ? ", node " : "node ") + std::to_string(node) + " (CPUs " + FormatCpuList(_node_cpus[node]) +
+                ")";
+    }
+
+    return text;
+}
+
+}
@@ -0,0 +1,164 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    profiler.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Scoped timers for the hot path and export as Chrome trace events.
+ *
+ * This program part drains the per-thread sample buffers and writes them in the JSON array format of the Chrome
+ * trace-event specification. Each sample becomes one complete event ("ph": "X").
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include "profiler.hpp"
+
+
+namespace GameOfLife
+{
+
+TraceBuffer::TraceBuffer(int thread_id)
+{
+    this->thread_id = thread_id;
+    this->dropped = 0;
+    this->samples.resize(capacity);
+    this->_head = 0;
+    this->_tail = 0;
+}
+
+/** @fn Profiler::Instance()
+ *  @brief Returns the one and only profiler of the program.
+ */
+Profiler &Profiler::Instance()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+/** @fn Profiler::Profiler()
+ *  @brief Constructor of the class Profiler.
+ *
+ */
+Profiler::Profiler()
+{
+    _epoch = std::chrono::steady_clock::now();
+    _trace_file = NULL;
+    _first_event = true;
+}
+
+/** @fn Profiler::~Profiler()
+ *  @brief Destructor of the class Profiler.
+ *
+ *  This functions writes the remaining samples and deletes all buffers.
+ */
+Profiler::~Profiler()
+{
+    this->Close();
+
+    for (TraceBuffer *buffer : _buffers)
+    {
+        delete buffer;
+    }
+}
+
+/** @fn Profiler::Open(std::string trace_file_name)
+ *  @brief Opens the trace file. Without an open file, the samples are drained and discarded.
+ */
+void Profiler::Open(std::string trace_file_name)
+{
+    this->Close();
+
+    _trace_file = fopen(trace_file_name.c_str(), "w");
+
+    if (_trace_file == NULL)
+    {
+        fprintf(stdout,"Cannot open the trace file %s. No trace will be written.\n", trace_file_name.c_str());
+        return;
+    }
+
+    fprintf(stdout,"Writing the hot path trace to %s.\n", trace_file_name.c_str());
+
+    fprintf(_trace_file, "[\n");
+    _first_event = true;
+}
+
+/** @fn Profiler::RegisterThread()
+ *  @brief Creates the buffer of the calling thread. This is the only place where the profiler takes a lock.
+ */
+TraceBuffer *Profiler::RegisterThread()
+{
+    std::lock_guard<std::mutex> lock(_registry_mutex);
+
+    TraceBuffer *buffer = new TraceBuffer((int) _buffers.size());
+    _buffers.push_back(buffer);
+
+    return buffer;
+}
+
+/** @fn Profiler::Flush()
+ *  @brief Moves all collected samples into the trace file.
+ */
+void Profiler::Flush()
+{
+    std::vector<TraceBuffer *> buffers;
+
+    {
+        std::lock_guard<std::mutex> lock(_registry_mutex);
+        buffers = _buffers;
+    }
+
+    for (TraceBuffer *buffer : buffers)
+    {
+        buffer->Drain([&](const struct_trace_sample &sample)
+        {
+            if (_trace_file == NULL)
+            {
+                return;
+            }
+
+            // Chrome expects the time stamps in microseconds.
+            fprintf(_trace_file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    _first_event ? "" : ",\n", sample.name, buffer->thread_id, sample.start_ns / 1000.0,
+                    sample.duration_ns / 1000.0);
+
+            _first_event = false;
+        });
+
+        uint64_t dropped = buffer->dropped.exchange(0);
+
+        if (dropped > 0)
+        {
+            fprintf(stdout,"\nProfiler: thread %d dropped %lu samples. Flush more often.\n", buffer->thread_id,
+                    (unsigned long) dropped);
+        }
+    }
+
+    if (_trace_file != NULL)
+    {
+        fflush(_trace_file);
+    }
+}
+
+/** @fn Profiler::Close()
+ *  @brief Writes the remaining samples and closes the JSON array.
+ */
+void Profiler::Close()
+{
+    if (_trace_file == NULL)
+    {
+        return;
+    }
+
+    this->Flush();
+
+    fprintf(_trace_file, "\n]\n");
+    fclose(_trace_file);
+
+    _trace_file = NULL;
+}
+
+}
@@ -0,0 +1,373 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    ruleExplorer.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Screens families of rules of life on the same random soup, without any window.
+ *
+ * This program part expands the families into rules, runs them on the worker pool, classifies them and writes the
+ * ranked table and optionally a CSV file with one line per rule.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <ctype.h>
+#include <stdio.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <unordered_set>
+
+#include "ruleExplorer.hpp"
+#include "workerPool.hpp"
+
+
+namespace GameOfLife
+{
+    // Bounding box of the living individuals.
+    struct struct_box
+    {
+        int top, bottom, left, right;
+    };
+
+/** @fn LivingBox(const LifeCycle &lifecycle, struct_box &box)
+ *  @brief Bounding box of the living individuals, false for an empty biotope.
+ */
+static bool LivingBox(const LifeCycle &lifecycle, struct_box &box)
+{
+    uint64_t buffer[tile_size];
+    bool found = false;
+
+    for (int slot = 0; slot < lifecycle.tiles.size(); slot++)
+    {
+        const struct_tile &tile = lifecycle.tiles[slot];
+        const uint64_t *rows = lifecycle.TileRows(slot, buffer);
+
+        for (int r = 0; r < tile_size; r++)
+        {
+            if (rows[r] == 0)
+            {
+                continue;
+            }
+
+            int row = tile.tile_row * tile_size + r;
+            int left = tile.tile_column * tile_size + __builtin_ctzll(rows[r]);
+            int right = tile.tile_column * tile_size + 63 - __builtin_clzll(rows[r]);
+
+            if (!found)
+            {
+                box = {row, row, left, right};
+                found = true;
+            }
+
+            box.top = std::min(box.top, row);
+            box.bottom = std::max(box.bottom, row);
+            box.left = std::min(box.left, left);
+            box.right = std::max(box.right, right);
+        }
+    }
+
+    return found;
+}
+
+/** @fn RuleExplorer::RuleExplorer(int rows, int columns, int soup_size, int live_rate, unsigned seed)
+ *  @brief Constructor of the class RuleExplorer. Creates the soup of soup_size x soup_size individuals.
+ */
+RuleExplorer::RuleExplorer(int rows, int columns, int soup_size, int live_rate, unsigned seed)
+{
+    this->_rows = rows;
+    this->_columns = columns;
+    this->_live_rate = live_rate;
+
+    // The soup needs room to grow, before it reaches the border.
+    soup_size = std::max(1, std::min(soup_size, std::min(rows, columns) / 2));
+
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> percent(0, 100);
+
+    for (int row = (rows - soup_size) / 2; row < (rows + soup_size) / 2; row++)
+    {
+        for (int column = (columns - soup_size) / 2; column < (columns + soup_size) / 2; column++)
+        {
+            if (percent(generator) < live_rate)
+            {
+                _soup.push_back({row, column, true});
+            }
+        }
+    }
+}
+
+/** @fn RuleExplorer::~RuleExplorer()
+ *  @brief Destructor of the class RuleExplorer.
+ *
+ */
+RuleExplorer::~RuleExplorer()
+{
+}
+
+/** @fn RuleExplorer::AddRules(std::string families)
+ *  @brief Expands the families into single rules. A rule, which is in several families, is run only once.
+ */
+int RuleExplorer::AddRules(std::string families)
+{
+    std::unordered_set<uint32_t> known;
+
+    for (const struct_rule_result &result : results)
+    {
+        known.insert(result.rule.birth << 9 | result.rule.survive);
+    }
+
+    std::stringstream stream(families);
+    std::string family;
+
+    while (std::getline(stream, family, ','))
+    {
+        // The stars are taken out, the rest is a normal rule with the counts, which every rule of the family has.
+        std::string fixed_text;
+        bool survive_part = false, birth_star = false, survive_star = false;
+
+        for (char symbol : family)
+        {
+            survive_part |= toupper(symbol) == 'S';
+
+            if (symbol == '*')
+            {
+                (survive_part ? survive_star : birth_star) = true;
+            }
+            else if (!isspace(symbol))
+            {
+                fixed_text += symbol;
+            }
+        }
+
+        struct_rule fixed;
+
+        if (!ParseRule(fixed_text, fixed))
+        {
+            fprintf(stdout,"Cannot read the rule family: %s. It is left out.\n", family.c_str());
+            continue;
+        }
+
+        uint16_t free_birth = birth_star ? 0x1fe & ~fixed.birth : 0;
+        uint16_t free_survive = survive_star ? 0x1ff & ~fixed.survive : 0;
+
+        // Every subset of the free counts, the empty one included.
+        for (uint16_t birth = free_birth; ; birth = (birth - 1) & free_birth)
+        {
+            for (uint16_t survive = free_survive; ; survive = (survive - 1) & free_survive)
+            {
+                struct_rule_result result = {};
+                result.rule = {(uint16_t) (fixed.birth | birth), (uint16_t) (fixed.survive | survive)};
+
+                if (known.insert(result.rule.birth << 9 | result.rule.survive).second)
+                {
+                    results.push_back(result);
+                }
+
+                if (survive == 0) break;
+            }
+
+            if (birth == 0) break;
+        }
+    }
+
+    return results.size();
+}
+
+/** @fn RuleExplorer::Run(int threads, int max_generations, int cycle_window)
+ *  @brief Runs all rules and ranks them.
+ */
+void RuleExplorer::Run(int threads, int max_generations, int cycle_window)
+{
+    fprintf(stdout,"Exploration of %lu rules with a soup of %lu individuals on %i x %i individuals on %i threads.\n",
+            (unsigned long) results.size(), (unsigned long) _soup.size(), _rows, _columns, threads);
+
+    auto start = std::chrono::steady_clock::now();
+    std::atomic<int> finished(0);
+
+    WorkerPool pool(threads);
+
+    _universes.clear();
+    _universes.resize(pool.Size());
+
+    pool.RunTasks(results.size(), [&](int task, int worker)
+    {
+        this->RunRule(results[task], worker, max_generations, cycle_window);
+
+        int done = ++finished;
+
+        if (worker == 0)
+        {
+            fprintf(stdout,"\rFinished %i of %lu rules.", done, (unsigned long) results.size());
+            fflush(stdout);
+        }
+    });
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    fprintf(stdout,"\rFinished %lu rules in %.3f s (%.1f rules/s).\n", (unsigned long) results.size(), seconds,
+            results.size() / seconds);
+
+    // With equal scores the slower growing soup ranks first, otherwise the order of the families is kept.
+    std::stable_sort(results.begin(), results.end(), [](const struct_rule_result &a, const struct_rule_result &b)
+    {
+        return a.score != b.score ? a.score > b.score : a.expansion_rate < b.expansion_rate;
+    });
+}
+
+void RuleExplorer::RunRule(struct_rule_result &result, int worker, int max_generations, int cycle_window)
+{
+    // The worker creates its life cycle itself, so the memory is first touched by the thread, which uses it.
+    if (!_universes[worker])
+    {
+        _universes[worker].reset(new LifeCycle(_rows, _columns, _rows * _columns, "empty", " ", _live_rate, false));
+        _universes[worker]->SetCycleDetection("halt", cycle_window);
+    }
+
+    LifeCycle &lifecycle = *_universes[worker];
+
+    lifecycle.SetRule(result.rule);
+    lifecycle.Restart(_soup);
+
+    struct_box soup = {}, box = {};
+    bool reached_border = false;
+
+    LivingBox(lifecycle, soup);
+    box = soup;
+
+    result.initial_population = lifecycle.Population();
+    result.peak_population = result.initial_population;
+
+    while (!lifecycle.Halted() && lifecycle.Population() > 0 && lifecycle.Generation() < max_generations)
+    {
+        lifecycle.LifeRules();
+        result.peak_population = std::max(result.peak_population, lifecycle.Population());
+
+        // Beyond the border the biotope is dead, a growing soup is not itself any more, once it touched it.
+        if (lifecycle.Generation() % 8 == 0 && LivingBox(lifecycle, box) &&
+            (box.top == 0 || box.left == 0 || box.bottom == _rows - 1 || box.right == _columns - 1))
+        {
+            reached_border = true;
+            break;
+        }
+    }
+
+    result.final_population = lifecycle.Population();
+    result.period = lifecycle.Cycle().detected ? lifecycle.Cycle().period : 0;
+
+    if (result.final_population > 0)
+    {
+        LivingBox(lifecycle, box);
+    }
+
+    uint64_t generations = lifecycle.Generation();
+
+    if (reached_border)
+    {
+        result.behaviour = rule_behaviour::explosive;
+        result.active_generations = generations;
+    }
+    else if (result.final_population == 0)
+    {
+        result.behaviour = rule_behaviour::dies_out;
+        result.active_generations = generations;
+    }
+    else if (lifecycle.Cycle().detected)
+    {
+        result.behaviour = result.period > 1 ? rule_behaviour::oscillating : rule_behaviour::still;
+        result.active_generations = lifecycle.Cycle().onset;
+    }
+    else
+    {
+        result.behaviour = rule_behaviour::chaotic;
+        result.active_generations = generations;
+    }
+
+    int growth = std::max({soup.top - box.top, box.bottom - soup.bottom, soup.left - box.left,
+                           box.right - soup.right, 0});
+
+    result.expansion_rate = result.final_population > 0 && generations > 0 ? (double) growth / generations : 0.0;
+
+    // Long activity ranks first, unless it is only the growth of an explosion.
+    result.score = (double) result.active_generations / std::max(max_generations, 1);
+
+    if (result.behaviour == rule_behaviour::explosive)
+    {
+        result.score *= 0.25;
+    }
+}
+
+/** @fn RuleExplorer::Report(int top, std::string output_file)
+ *  @brief Prints the number of rules per behaviour and the best rules.
+ */
+void RuleExplorer::Report(int top, std::string output_file)
+{
+    static const char *behaviours[] = {"dies_out", "still", "oscillating", "chaotic", "explosive"};
+
+    int counts[5] = {};
+
+    for (const struct_rule_result &result : results)
+    {
+        counts[result.behaviour]++;
+    }
+
+    fprintf(stdout,"\n");
+
+    for (int behaviour = 0; behaviour < 5; behaviour++)
+    {
+        fprintf(stdout,"%s%s: %i", behaviour > 0 ? ", " : "", behaviours[behaviour], counts[behaviour]);
+    }
+
+    fprintf(stdout,"\n\n%5s %-20s %-12s %9s %9s %9s %8s %7s %10s %7s\n", "rank", "rule", "behaviour", "initial",
+            "peak", "final", "active", "period", "expansion", "score");
+
+    for (int rank = 0; rank < top && rank < results.size(); rank++)
+    {
+        const struct_rule_result &result = results[rank];
+
+        fprintf(stdout,"%5i %-20s %-12s %9lu %9lu %9lu %8lu %7lu %10.3f %7.3f\n", rank + 1,
+                RuleName(result.rule).c_str(), behaviours[result.behaviour],
+                (unsigned long) result.initial_population, (unsigned long) result.peak_population,
+                (unsigned long) result.final_population, (unsigned long) result.active_generations,
+                (unsigned long) result.period, result.expansion_rate, result.score);
+    }
+
+    if (output_file.empty())
+    {
+        return;
+    }
+
+    FILE *file = fopen(output_file.c_str(), "w");
+
+    if (file == NULL)
+    {
+        fprintf(stdout,"Cannot open the exploration output file %s.\n", output_file.c_str());
+        return;
+    }
+
+    fprintf(file, "rank,rule,behaviour,initial_population,peak_population,final_population,active_generations,"
+            "period,expansion_rate,score\n");
+
+    for (int rank = 0; rank < results.size(); rank++)
+    {
+        const struct_rule_result &result = results[rank];
+
+        fprintf(file, "%i,%s,%s,%lu,%lu,%lu,%lu,%lu,%.4f,%.4f\n", rank + 1, RuleName(result.rule).c_str(),
+                behaviours[result.behaviour], (unsigned long) result.initial_population,
+                (unsigned long) result.peak_population, (unsigned long) result.final_population,
+                (unsigned long) result.active_generations, (unsigned long) result.period, result.expansion_rate,
+                result.score);
+    }
+
+    fclose(file);
+
+    fprintf(stdout,"The results of all rules were written to %s.\n", output_file.c_str());
+}
+
+}
@@ -0,0 +1,128 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    sharedReader.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Export of the biotope into POSIX shared memory.
+ *
+ * This program part maps the shared memory object read-only and implements the reading side of the sequence lock.
+ * It does not depend on the life cycle, so external tools link only this file.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "sharedState.hpp"
+
+
+namespace GameOfLife
+{
+
+/** @fn SharedStateReader::SharedStateReader(std::string name)
+ *  @brief Constructor of the class SharedStateReader.
+ *
+ */
+SharedStateReader::SharedStateReader(std::string name)
+{
+    this->_header = nullptr;
+    this->_size = 0;
+
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+
+    if (fd < 0)
+    {
+        fprintf(stdout,"Cannot open the shared memory %s: %s\n", name.c_str(), strerror(errno));
+        return;
+    }
+
+    struct stat status;
+    fstat(fd, &status);
+    _size = status.st_size;
+
+    void *memory = _size >= sizeof(struct_shared_header) ? mmap(NULL, _size, PROT_READ, MAP_SHARED, fd, 0)
+                                                         : MAP_FAILED;
+    close(fd);
+
+    if (memory == MAP_FAILED)
+    {
+        fprintf(stdout,"Cannot map the shared memory %s.\n", name.c_str());
+        return;
+    }
+
+    _header = (const struct_shared_header *) memory;
+
+    if (memcmp(_header->magic, shared_state_magic, sizeof _header->magic) != 0)
+    {
+        fprintf(stdout,"The shared memory %s does not contain a biotope.\n", name.c_str());
+        munmap(memory, _size);
+        _header = nullptr;
+    }
+}
+
+/** @fn SharedStateReader::~SharedStateReader()
+ *  @brief Destructor of the class SharedStateReader.
+ *
+ */
+SharedStateReader::~SharedStateReader()
+{
+    if (_header != nullptr)
+    {
+        munmap((void *) _header, _size);
+    }
+}
+
+/** @fn SharedStateReader::ReadLatest(std::vector<uint64_t> &frame, uint64_t &generation, uint64_t &population)
+ *  @brief Copies the newest complete frame. Returns false, if nothing was published yet.
+ */
+bool SharedStateReader::ReadLatest(std::vector<uint64_t> &frame, uint64_t &generation, uint64_t &population)
+{
+    if (_header == nullptr)
+    {
+        return false;
+    }
+
+    frame.resize(_header->frame_bytes / sizeof(uint64_t));
+
+    while (true)
+    {
+        uint64_t published = _header->published.load(std::memory_order_acquire);
+
+        if (published == 0)
+        {
+            return false;
+        }
+
+        const struct_shared_frame *shared_frame = FrameHeader(_header, (published - 1) % _header->slots);
+
+        uint64_t before = shared_frame->sequence.load(std::memory_order_acquire);
+
+        if (before & 1)
+        {
+            continue;
+        }
+
+        memcpy(frame.data(), FrameData(_header, (published - 1) % _header->slots), _header->frame_bytes);
+        generation = shared_frame->generation;
+        population = shared_frame->population;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (shared_frame->sequence.load(std::memory_order_relaxed) == before)
+        {
+            return true;
+        }
+    }
+}
+
+}
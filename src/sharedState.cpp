@@ -0,0 +1,158 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    sharedState.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Export of the biotope into POSIX shared memory.
+ *
+ * This program part creates and maps the shared memory object and implements the writing side of the sequence lock.
+ * The reading side is in sharedReader.cpp, so external tools do not need the life cycle.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "sharedState.hpp"
+#include "lifeCycle.hpp"
+
+
+namespace GameOfLife
+{
+
+/** @fn SharedStateExporter::SharedStateExporter(std::string name, int slots, const LifeCycle &lifecycle)
+ *  @brief Constructor of the class SharedStateExporter.
+ *
+ *  Creates the shared memory object with the given name (e.g. "/game_of_life") and publishes the current generation.
+ */
+SharedStateExporter::SharedStateExporter(std::string name, int slots, const LifeCycle &lifecycle)
+{
+    this->_name = name;
+    this->_header = nullptr;
+
+    slots = slots < 2 ? 2 : slots;
+
+    uint64_t words_per_row = lifecycle.tiles_x;
+    uint64_t frame_bytes = (uint64_t) lifecycle.Rows() * words_per_row * sizeof(uint64_t);
+    uint64_t slot_bytes = (sizeof(struct_shared_frame) + frame_bytes + 63) / 64 * 64;
+
+    _size = sizeof(struct_shared_header) + slots * slot_bytes;
+
+    int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0644);
+
+    if (fd < 0 || ftruncate(fd, _size) != 0)
+    {
+        fprintf(stdout,"Cannot create the shared memory %s: %s\n", name.c_str(), strerror(errno));
+
+        if (fd >= 0) close(fd);
+        return;
+    }
+
+    void *memory = mmap(NULL, _size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if (memory == MAP_FAILED)
+    {
+        fprintf(stdout,"Cannot map the shared memory %s: %s\n", name.c_str(), strerror(errno));
+        return;
+    }
+
+    _header = new (memory) struct_shared_header;
+    _header->slots = slots;
+    _header->rows = lifecycle.Rows();
+    _header->columns = lifecycle.Columns();
+    _header->words_per_row = words_per_row;
+    _header->frame_bytes = frame_bytes;
+    _header->slot_bytes = slot_bytes;
+    _header->published.store(0, std::memory_order_relaxed);
+
+    for (int slot = 0; slot < slots; slot++)
+    {
+        new (FrameHeader(_header, slot)) struct_shared_frame;
+        FrameHeader(_header, slot)->sequence.store(0, std::memory_order_relaxed);
+    }
+
+    // The magic comes last, readers check it before they trust the rest of the header.
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(_header->magic, shared_state_magic, sizeof _header->magic);
+
+    _slot_stamp.assign(slots, 0);
+
+    fprintf(stdout,"Each generation is published into the shared memory %s (%i frames of %lu bytes).\n", name.c_str(),
+            slots, (unsigned long) frame_bytes);
+}
+
+/** @fn SharedStateExporter::~SharedStateExporter()
+ *  @brief Destructor of the class SharedStateExporter.
+ *
+ *  Readers, which still have the memory mapped, keep their copy until they unmap it.
+ */
+SharedStateExporter::~SharedStateExporter()
+{
+    if (_header != nullptr)
+    {
+        munmap(_header, _size);
+        shm_unlink(_name.c_str());
+    }
+}
+
+/** @fn SharedStateExporter::Publish(const LifeCycle &lifecycle)
+ *  @brief Writes the current generation into the oldest frame of the ring.
+ *
+ *  Edits of single individuals become visible with the next published frame.
+ */
+void SharedStateExporter::Publish(const LifeCycle &lifecycle)
+{
+    if (_header == nullptr)
+    {
+        return;
+    }
+
+    uint64_t published = _header->published.load(std::memory_order_relaxed);
+    uint64_t ring_slot = published % _header->slots;
+
+    struct_shared_frame *frame = FrameHeader(_header, ring_slot);
+    uint64_t *data = FrameData(_header, ring_slot);
+    uint64_t sequence = frame->sequence.load(std::memory_order_relaxed);
+
+    // Sequence lock: odd number while writing.
+    frame->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (int slot = 0; slot < lifecycle.tiles.size(); slot++)
+    {
+        if (lifecycle.TileStamp(slot) <= _slot_stamp[ring_slot])
+        {
+            continue;
+        }
+
+        const struct_tile &tile = lifecycle.tiles[slot];
+        uint64_t buffer[tile_size];
+        const uint64_t *rows = lifecycle.TileRows(slot, buffer);
+
+        for (int r = 0; r < tile.valid_rows; r++)
+        {
+            data[(size_t) (tile.tile_row * tile_size + r) * _header->words_per_row + tile.tile_column] = rows[r];
+        }
+    }
+
+    frame->generation = lifecycle.Generation();
+    frame->population = lifecycle.Population();
+
+    frame->sequence.store(sequence + 2, std::memory_order_release);
+    _slot_stamp[ring_slot] = lifecycle.ChangeStamp();
+
+    _header->published.store(published + 1, std::memory_order_release);
+}
+
+}
@@ -0,0 +1,69 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    sharedWatch.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Small viewer of the biotope in the shared memory.
+ *
+ * This program attaches to the shared memory of a running Game_of_Life and prints the generation, population and
+ * density of the newest frame. It is an example for dashboards and analysis tools.
+ * Usage: Game_of_Life_Watch [name] [interval in ms]
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <chrono>
+#include <thread>
+
+#include "sharedState.hpp"
+
+
+int main (int argc, char *argv[])
+{
+        std::string name = argc > 1 ? argv[1] : "/game_of_life";
+        int interval_ms = argc > 2 ? atoi(argv[2]) : 1000;
+
+        GameOfLife::SharedStateReader reader(name);
+
+        if (!reader.IsOpen())
+        {
+            return 1;
+        }
+
+        fprintf(stdout,"Watching %s: %u x %u individuals, %u frames in the ring.\n", name.c_str(),
+                reader.header()->rows, reader.header()->columns, reader.header()->slots);
+
+        std::vector<uint64_t> frame;
+        uint64_t generation = 0, population = 0, last_generation = 0;
+
+        while (true)
+        {
+            if (reader.ReadLatest(frame, generation, population))
+            {
+                // Count again from the frame, as an example how to use the bits.
+                uint64_t counted = 0;
+
+                for (uint64_t word : frame)
+                {
+                    counted += __builtin_popcountll(word);
+                }
+
+                fprintf(stdout,"Generation %lu, population %lu (%lu counted), density %.3f %%, %.1f generations/s\n",
+                        (unsigned long) generation, (unsigned long) population, (unsigned long) counted,
+                        100.0 * population / ((double) reader.header()->rows * reader.header()->columns),
+                        (generation - last_generation) * 1000.0 / interval_ms);
+
+                last_generation = generation;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+        }
+
+	return 0;
+}
@@ -18,6 +18,8 @@
 #include <stdio.h>
 #include <math.h>
 #include <stdlib.h> 
+#include <algorithm>
+#include <unordered_map>
 #include "visual2d.hpp"
 
 namespace GameOfLife
@@ -42,6 +44,25 @@ Visual2D::Visual2D(int number_of_elements, std::string window_form)
     
     Visual2D::window_posx = 0;
     Visual2D::window_posy = 0;
+
+    this->_viewport_x = 0;
+    this->_viewport_y = 0;
+    this->_viewport_width = 0;
+    this->_viewport_height = 0;
+    this->_origin_x = 0.0;
+    this->_origin_y = 0.0;
+    this->_scale = 1.0;
+    this->_camera_ready = false;
+    this->_view_changed = true;
+    this->_pixels_changed = false;
+    this->_render_stamp = 0;
+    this->_dragging = false;
+    this->_drag_x = 0;
+    this->_drag_y = 0;
+    this->_board_rows = 0;
+    this->_board_columns = 0;
+    this->_color_mode = color_mode::grey;
+    this->_warm_frames = 0;
     
     // Get screen resolution.
     desktop = sf::VideoMode().getDesktopMode();
@@ -329,100 +350,463 @@ inline int Visual2D::get_element_size (int num_of_elem, int a, int b)
 }
 
 /** @fn Visual2D::BiotopeConfigurator()
- *  @brief Prepare the vertices of the scenery.
+ *  @brief Prepare the picture of the scenery.
  *
- *  This functions creates the vertices and configures the states of each individual in the biotope. The whole map
- *  will be contained in a single vertex array, therefore it  will be super fast to draw.
+ *  This functions places the window and the viewport. The area of the grid is the viewport of the camera. The buffers
+ *  of the picture follow with the first drawing, see CreateBuffers().
  */
 void Visual2D::BiotopeConfigurator()
 {    
     // Sets the position of the window on the screen.
     Visual2D::window_posx = 0.5 * (desktop.width - Visual2D::window_width);
     Visual2D::window_posy = 0.5 * (desktop.height - Visual2D::window_height);
-	
-    // Draw the whole scenery. (https://www.sfml-dev.org/tutorials/2.5/graphics-vertex-array.php)    
-    // Create the biotope
-    biotope_map.setPrimitiveType(sf::Quads);
-    biotope_map.resize(res_num_elements * 4);    
-    
-    // Start Point Width
-    int spw = 0.5 * (Visual2D::window_width - Visual2D::grid_width);
-    
-    // Start Point Height
-    int sph = 0.5 * (Visual2D::window_height - Visual2D::grid_height);
-    
-    int particle = 0;
-    
-    int ax, bx, cx, dx, ay, by, cy, dy;
-    
-    // Give each individual a position and color.
-    for (int i = 0; i < rows; i++)
+
+    // Start Point Width and Height
+    _viewport_x = 0.5 * (Visual2D::window_width - Visual2D::grid_width);
+    _viewport_y = 0.5 * (Visual2D::window_height - Visual2D::grid_height);
+    _viewport_width = Visual2D::grid_width;
+    _viewport_height = Visual2D::grid_height;
+}
+
+/** @fn Visual2D::CreateBuffers()
+ *  @brief Creates the pixel buffer and the texture with the size of the window.
+ *
+ *  The whole map is drawn into this single texture, therefore it will be super fast to draw. The texture needs the
+ *  graphics context of the window, so it is only created, when the first picture is drawn into an open window.
+ */
+void Visual2D::CreateBuffers()
+{
+    // Grey background
+    _pixels.assign((size_t) Visual2D::window_width * Visual2D::window_height * 4, 128);
+
+    biotope_texture.create(Visual2D::window_width, Visual2D::window_height);
+    biotope_sprite.setTexture(biotope_texture, true);
+}
+
+/** @fn Visual2D::SetColorMode(std::string mode)
+ *  @brief Chooses the colors of the individuals: grey or age.
+ *
+ *  The palette of the ages runs from white-yellow for a birth over orange, red and purple to dark blue for an
+ *  individual, which is 255 generations or older. Dead individuals are black.
+ */
+void Visual2D::SetColorMode(std::string mode)
+{
+    static std::unordered_map<std::string, color_mode> const table =
+        { {"grey", color_mode::grey},
+        {"age", color_mode::age} };
+
+    auto it = table.find(mode);
+
+    if (it != table.end())
+    {
+        fprintf(stdout,"The biotope will be drawn with the color mode: %s.\n", mode.c_str());
+        _color_mode = it->second;
+    }
+    else
     {
-        for (int j = 0; j < columns; j++)      
+        _color_mode = color_mode::grey;
+        fprintf(stdout,"Cannot find the color mode: %s. The program will continue with grey.\n", mode.c_str());
+    }
+
+    // Age, red, green, blue. The colors between are interpolated.
+    static const int keys[][4] =
+        { {1, 255, 255, 224}, {4, 255, 224, 0}, {16, 255, 96, 0}, {48, 200, 0, 64}, {120, 96, 0, 160},
+        {255, 0, 32, 128} };
+
+    _palette[0][0] = _palette[0][1] = _palette[0][2] = 0;
+    _palette[0][3] = 255;
+
+    for (int age = 1, key = 0; age < 256; age++)
+    {
+        while (age > keys[key + 1][0])
         {
-            particle = (j + i * columns) * 4;
-            
-            ax = spw + j * _element_size;
-            ay = sph + i * _element_size;
-            
-            bx = spw + (j + 1) * _element_size;
-            by = sph + i * _element_size;
-            
-            cx = spw + (j + 1) * _element_size;
-            cy = sph + (i + 1) * _element_size;
-            
-            dx = spw + j * _element_size;
-            dy = sph + (i + 1) * _element_size; 
-        
-            biotope_map[particle    ].position = sf::Vector2f(ax, ay);
-            biotope_map[particle + 1].position = sf::Vector2f(bx, by);
-            biotope_map[particle + 2].position = sf::Vector2f(cx, cy);
-            biotope_map[particle + 3].position = sf::Vector2f(dx, dy);
-
-            biotope_map[particle    ].color    = sf::Color::White;
-            biotope_map[particle + 1].color    = sf::Color::White;
-            biotope_map[particle + 2].color    = sf::Color::White;
-            biotope_map[particle + 3].color    = sf::Color::White;
+            key++;
+        }
+
+        double t = (double) (age - keys[key][0]) / (keys[key + 1][0] - keys[key][0]);
+
+        for (int channel = 0; channel < 3; channel++)
+        {
+            _palette[age][channel] = (sf::Uint8) round(keys[key][channel + 1] +
+                                                       t * (keys[key + 1][channel + 1] - keys[key][channel + 1]));
         }
+
+        _palette[age][3] = 255;
     }
+
+    _view_changed = true;
 }
 
-/** @fn Visual2D::GridUpdater()
- *  @brief Changes the color of the individual with respect to its status.
+/** @fn Visual2D::CameraConfigurator(const LifeCycle &lifecycle)
+ *  @brief Places the camera in a way, that the whole biotope is visible.
  *
- *  This functions checks continuously the biotope and change the color to the status of each individual.
+ *  If the biotope has the size of the grid, this gives the same picture as one element of _element_size pixels per
+ *  individual. A larger biotope gets the whole window as viewport.
  */
-void Visual2D::GridUpdater(std::vector<struct_individuals> &individuals)
+void Visual2D::CameraConfigurator(const LifeCycle &lifecycle)
 {
-    int particle = 0;
+    _board_rows = lifecycle.Rows();
+    _board_columns = lifecycle.Columns();
+
+    if (_board_rows != rows || _board_columns != columns)
+    {
+        _viewport_x = 0;
+        _viewport_y = 0;
+        _viewport_width = Visual2D::window_width;
+        _viewport_height = Visual2D::window_height;
+    }
+
+    _scale = std::min((double) _viewport_width / _board_columns, (double) _viewport_height / _board_rows);
+    _origin_x = 0.5 * (_board_columns - _viewport_width / _scale);
+    _origin_y = 0.5 * (_board_rows - _viewport_height / _scale);
+
+    _mipmap.Rebuild(lifecycle);
+    _render_stamp = lifecycle.ChangeStamp();
 
-    // Get an update on the status of the individuals
-    for (int i = 0; i < individuals.size(); i++)
+    _warm.assign(lifecycle.tiles.size(), 0);
+    _queued.assign(lifecycle.tiles.size(), 0);
+    _warm_slots.clear();
+
+    fprintf(stdout,"The camera shows %i x %i individuals with %.3f pixel per individual and %i levels of detail.\n",
+            _board_rows, _board_columns, _scale, _mipmap.Levels());
+
+    _camera_ready = true;
+    _view_changed = true;
+}
+
+/** @fn Visual2D::HandleEvent(const sf::Event &event)
+ *  @brief Moves and zooms the camera.
+ *
+ *  Mouse wheel and +/-: zoom at the cursor or the center. Middle mouse button or arrow keys: move. Home: show all.
+ */
+void Visual2D::HandleEvent(const sf::Event &event)
+{
+    if (!_camera_ready)
+    {
+        return;
+    }
+
+    switch(event.type)
+    {
+        case sf::Event::MouseWheelScrolled :
+            this->Zoom(event.mouseWheelScroll.delta > 0 ? 1.25f : 0.8f, event.mouseWheelScroll.x,
+                       event.mouseWheelScroll.y);
+            break;
+        case sf::Event::MouseButtonPressed :
+            if (event.mouseButton.button == sf::Mouse::Middle)
+            {
+                _dragging = true;
+                _drag_x = event.mouseButton.x;
+                _drag_y = event.mouseButton.y;
+            }
+            break;
+        case sf::Event::MouseButtonReleased :
+            if (event.mouseButton.button == sf::Mouse::Middle)
+            {
+                _dragging = false;
+            }
+            break;
+        case sf::Event::MouseMoved :
+            if (_dragging)
+            {
+                this->Pan((_drag_x - event.mouseMove.x) / _scale, (_drag_y - event.mouseMove.y) / _scale);
+                _drag_x = event.mouseMove.x;
+                _drag_y = event.mouseMove.y;
+            }
+            break;
+        case sf::Event::KeyPressed :
+            switch(event.key.code)
+            {
+                case sf::Keyboard::Add :
+                case sf::Keyboard::Equal :
+                    this->Zoom(1.25f, _viewport_x + _viewport_width / 2, _viewport_y + _viewport_height / 2);
+                    break;
+                case sf::Keyboard::Subtract :
+                case sf::Keyboard::Hyphen :
+                    this->Zoom(0.8f, _viewport_x + _viewport_width / 2, _viewport_y + _viewport_height / 2);
+                    break;
+                case sf::Keyboard::Left :
+                    this->Pan(-0.1 * _viewport_width / _scale, 0.0);
+                    break;
+                case sf::Keyboard::Right :
+                    this->Pan(0.1 * _viewport_width / _scale, 0.0);
+                    break;
+                case sf::Keyboard::Up :
+                    this->Pan(0.0, -0.1 * _viewport_height / _scale);
+                    break;
+                case sf::Keyboard::Down :
+                    this->Pan(0.0, 0.1 * _viewport_height / _scale);
+                    break;
+                case sf::Keyboard::Home :
+                    _scale = std::min((double) _viewport_width / _board_columns,
+                                      (double) _viewport_height / _board_rows);
+                    _origin_x = 0.5 * (_board_columns - _viewport_width / _scale);
+                    _origin_y = 0.5 * (_board_rows - _viewport_height / _scale);
+                    _view_changed = true;
+                    break;
+                default:
+                    break;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/** @fn Visual2D::CellAt(int x, int y, int &row, int &column)
+ *  @brief Individual below a pixel of the window, e.g. below the mouse cursor.
+ */
+bool Visual2D::CellAt(int x, int y, int &row, int &column) const
+{
+    if (!_camera_ready || x < _viewport_x || x >= _viewport_x + _viewport_width || y < _viewport_y ||
+        y >= _viewport_y + _viewport_height)
+    {
+        return false;
+    }
+
+    row = (int) floor(_origin_y + (y - _viewport_y + 0.5) / _scale);
+    column = (int) floor(_origin_x + (x - _viewport_x + 0.5) / _scale);
+
+    return row >= 0 && row < _board_rows && column >= 0 && column < _board_columns;
+}
+
+/** @fn Visual2D::Zoom(float factor, int x, int y)
+ *  @brief Changes the scale, the individual below the pixel (x, y) stays at its place.
+ */
+void Visual2D::Zoom(float factor, int x, int y)
+{
+    // Not smaller than half of the fitted view, not larger than 64 pixel per individual.
+    double min_scale = 0.5 * std::min((double) _viewport_width / _board_columns,
+                                      (double) _viewport_height / _board_rows);
+    double new_scale = std::max(min_scale, std::min(64.0, _scale * factor));
+
+    double board_x = _origin_x + (x - _viewport_x) / _scale;
+    double board_y = _origin_y + (y - _viewport_y) / _scale;
+
+    _scale = new_scale;
+    _origin_x = board_x - (x - _viewport_x) / _scale;
+    _origin_y = board_y - (y - _viewport_y) / _scale;
+
+    _view_changed = true;
+}
+
+void Visual2D::Pan(double dx, double dy)
+{
+    _origin_x += dx;
+    _origin_y += dy;
+
+    _view_changed = true;
+}
+
+/** @fn Visual2D::DetailLevel()
+ *  @brief Level of the mipmap, which fits to the current scale. 0 means single individuals.
+ */
+int Visual2D::DetailLevel() const
+{
+    if (_scale >= 1.0)
     {
-        // If there were changes, we manipulate the color in the grid.
-        // if (individuals.at(i).change)
-        if (true)
+        return 0;
+    }
+
+    int level = (int) floor(log2(1.0 / _scale));
+
+    return std::max(0, std::min(level, _mipmap.Levels()));
+}
+
+/** @fn Visual2D::RenderRegion(const LifeCycle &lifecycle, int x0, int y0, int x1, int y1)
+ *  @brief Draws the pixels of the rectangle [x0, x1) x [y0, y1) of the window.
+ */
+void Visual2D::RenderRegion(const LifeCycle &lifecycle, int x0, int y0, int x1, int y1)
+{
+    // Only inside of the viewport.
+    x0 = std::max(x0, _viewport_x);
+    y0 = std::max(y0, _viewport_y);
+    x1 = std::min(x1, _viewport_x + _viewport_width);
+    y1 = std::min(y1, _viewport_y + _viewport_height);
+
+    if (x0 >= x1 || y0 >= y1)
+    {
+        return;
+    }
+
+    int level = this->DetailLevel();
+    bool ages = _color_mode == color_mode::age && lifecycle.CellAgesEnabled() && _mipmap.HasHeat();
+
+    // Column of the biotope for each pixel column, -1 outside of the biotope.
+    std::vector<int> board_columns(x1 - x0);
+
+    for (int x = x0; x < x1; x++)
+    {
+        int column = (int) floor(_origin_x + (x - _viewport_x + 0.5) / _scale);
+        board_columns[x - x0] = column >= 0 && column < _board_columns ? column : -1;
+    }
+
+    for (int y = y0; y < y1; y++)
+    {
+        int row = (int) floor(_origin_y + (y - _viewport_y + 0.5) / _scale);
+        sf::Uint8 *pixel = &_pixels[((size_t) y * Visual2D::window_width + x0) * 4];
+
+        for (int x = x0; x < x1; x++, pixel += 4)
         {
-            particle = i * 4;
-        
-            if (individuals.at(i).alive)
+            int column = board_columns[x - x0];
+            sf::Uint8 grey = 128;
+
+            if (row >= 0 && row < _board_rows && column >= 0 && ages)
+            {
+                // The heat of a block is 256 minus the age of its youngest individual.
+                int age = level == 0 ? lifecycle.CellAge(row, column) :
+                                       (256 - _mipmap.Heat(level, row >> level, column >> level)) & 255;
+
+                pixel[0] = _palette[age][0];
+                pixel[1] = _palette[age][1];
+                pixel[2] = _palette[age][2];
+                pixel[3] = 255;
+                continue;
+            }
+
+            if (row >= 0 && row < _board_rows && column >= 0)
+            {
+                if (level == 0)
+                {
+                    grey = lifecycle.IsAlive(row, column) ? 0 : 255;
+                }
+                else
+                {
+                    grey = 255 - _mipmap.Density(level, row >> level, column >> level);
+                }
+            }
+
+            pixel[0] = grey;
+            pixel[1] = grey;
+            pixel[2] = grey;
+            pixel[3] = 255;
+        }
+    }
+
+    _pixels_changed = true;
+}
+
+/** @fn Visual2D::RenderTile(const LifeCycle &lifecycle, int slot)
+ *  @brief Draws the pixels, which are influenced by one tile.
+ *
+ *  On coarse levels a block is larger than the tile, so the whole block has to be drawn again.
+ */
+void Visual2D::RenderTile(const LifeCycle &lifecycle, int slot)
+{
+    const struct_tile &tile = lifecycle.tiles[slot];
+
+    int block = 1 << this->DetailLevel();
+    int block_size = std::max(block, tile_size);
+
+    int row0 = tile.tile_row * tile_size / block_size * block_size;
+    int column0 = tile.tile_column * tile_size / block_size * block_size;
+
+    int x0 = (int) floor(_viewport_x + (column0 - _origin_x) * _scale);
+    int y0 = (int) floor(_viewport_y + (row0 - _origin_y) * _scale);
+    int x1 = (int) ceil(_viewport_x + (column0 + block_size - _origin_x) * _scale) + 1;
+    int y1 = (int) ceil(_viewport_y + (row0 + block_size - _origin_y) * _scale) + 1;
+
+    this->RenderRegion(lifecycle, x0, y0, x1, y1);
+}
+
+/** @fn Visual2D::RefreshWarmTiles(const LifeCycle &lifecycle)
+ *  @brief Adds the warm tiles to the changed tiles every few frames, so their colors follow the ages.
+ */
+void Visual2D::RefreshWarmTiles(const LifeCycle &lifecycle)
+{
+    for (int slot : _changed_slots)
+    {
+        _queued[slot] = 1;
+
+        if (!_warm[slot])
+        {
+            _warm[slot] = 1;
+            _warm_slots.push_back(slot);
+        }
+    }
+
+    if (++_warm_frames >= warm_refresh_frames)
+    {
+        _warm_frames = 0;
+
+        // A saturated tile is drawn one last time and is cold then.
+        size_t kept = 0;
+
+        for (int slot : _warm_slots)
+        {
+            if (!_queued[slot])
+            {
+                _changed_slots.push_back(slot);
+            }
+
+            if (lifecycle.TileAgesSaturated(slot))
             {
-                biotope_map[particle    ].color    = sf::Color::Black;
-                biotope_map[particle + 1].color    = sf::Color::Black;
-                biotope_map[particle + 2].color    = sf::Color::Black;
-                biotope_map[particle + 3].color    = sf::Color::Black;
+                _warm[slot] = 0;
             }
             else
-            {            
-                biotope_map[particle    ].color    = sf::Color::White;
-                biotope_map[particle + 1].color    = sf::Color::White;
-                biotope_map[particle + 2].color    = sf::Color::White;
-                biotope_map[particle + 3].color    = sf::Color::White;
+            {
+                _warm_slots[kept++] = slot;
             }
-            
-            // Set the notifier back to false.
-            individuals.at(i).change = false;
         }
+
+        _warm_slots.resize(kept);
+    }
+
+    for (int slot : _changed_slots)
+    {
+        _queued[slot] = 0;
+    }
+}
+
+/** @fn Visual2D::GridUpdater()
+ *  @brief Changes the color of the individual with respect to its status.
+ *
+ *  This functions updates the levels of detail of the changed tiles and draws them again. After a move of the
+ *  camera the whole viewport is drawn.
+ */
+void Visual2D::GridUpdater(LifeCycle &lifecycle)
+{
+    if (_pixels.empty())
+    {
+        this->CreateBuffers();
+    }
+
+    if (!_camera_ready)
+    {
+        this->CameraConfigurator(lifecycle);
+    }
+    else
+    {
+        // Several generations or edits can lie between two frames.
+        lifecycle.ChangedTilesSince(_render_stamp, _changed_slots);
+        _render_stamp = lifecycle.ChangeStamp();
+
+        if (_color_mode == color_mode::age && _mipmap.HasHeat())
+        {
+            this->RefreshWarmTiles(lifecycle);
+        }
+
+        _mipmap.Update(lifecycle, _changed_slots);
+    }
+
+    if (_view_changed)
+    {
+        this->RenderRegion(lifecycle, _viewport_x, _viewport_y, _viewport_x + _viewport_width,
+                           _viewport_y + _viewport_height);
+        _view_changed = false;
+    }
+    else
+    {
+        for (int slot : _changed_slots)
+        {
+            this->RenderTile(lifecycle, slot);
+        }
+    }
+
+    if (_pixels_changed)
+    {
+        biotope_texture.update(_pixels.data());
+        _pixels_changed = false;
     }
 }
 
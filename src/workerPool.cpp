@@ -0,0 +1,323 @@
+// ========================================== max. 120 symbols in one line ============================================
+/**
+ * @par Project
+ * Game_of_Life
+ *
+ * @file    workerPool.cpp
+ * @author  Andre Alexander Pieper
+ * @version 1.0
+ * @date    2026-10-19
+ *
+ * @brief   Persistent worker threads for the parallel parts of the life cycle.
+ *
+ * This program part starts the worker threads once and hands out the chunks of each parallel loop.
+ */
+// --------------------------------------------------------------------------------------------------------------------
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#include "workerPool.hpp"
+
+
+namespace GameOfLife
+{
+
+/** @fn PinThread(int cpu)
+ *  @brief Lets the calling thread run on one CPU only.
+ */
+static void PinThread(int cpu)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+
+    if (pthread_setaffinity_np(pthread_self(), sizeof set, &set) != 0)
+    {
+        fprintf(stdout,"A thread cannot be pinned to the CPU %i.\n", cpu);
+    }
+}
+
+/** @fn WorkerPool::WorkerPool(int threads, std::vector<int> cpus)
+ *  @brief Constructor of the class WorkerPool.
+ *
+ *  The calling thread counts as one of the threads. With CPUs it is pinned as well, but only during a job, see
+ *  PinCaller().
+ */
+WorkerPool::WorkerPool(int threads, std::vector<int> cpus)
+{
+    this->_threads = threads < 1 ? 1 : threads;
+    this->_cpus = cpus.size() >= _threads ? cpus : std::vector<int>();
+    this->_fixed_parts = false;
+    this->_job_generation = 0;
+    this->_busy_workers = 0;
+    this->_shutdown = false;
+    this->_next_index = 0;
+    this->_count = 0;
+    this->_grain = 1;
+
+    for (int i = 0; i < _threads; i++)
+    {
+        _queues.emplace_back(new struct_task_queue);
+    }
+
+    CPU_ZERO(&_caller_cpus);
+
+    if (!_cpus.empty() && pthread_getaffinity_np(pthread_self(), sizeof _caller_cpus, &_caller_cpus) == 0 &&
+        !CPU_ISSET(_cpus[0], &_caller_cpus))
+    {
+        fprintf(stdout,"A thread cannot be pinned to the CPU %i.\n", _cpus[0]);
+    }
+
+    for (int i = 1; i < _threads; i++)
+    {
+        _workers.emplace_back(&WorkerPool::WorkerLoop, this, i);
+    }
+}
+
+/** @fn WorkerPool::~WorkerPool()
+ *  @brief Destructor of the class WorkerPool.
+ *
+ *  This functions stops and joins all worker threads.
+ */
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _shutdown = true;
+    }
+
+    _start_condition.notify_all();
+
+    for (std::thread &worker : _workers)
+    {
+        worker.join();
+    }
+}
+
+/** @fn WorkerPool::ParallelFor(int count, int grain, std::function<void(int, int, int)> function)
+ *  @brief Calls the function for all chunks of [0, count) and returns after the last chunk is done.
+ */
+void WorkerPool::ParallelFor(int count, int grain, std::function<void(int begin, int end, int worker)> function)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+
+    // Not worth to wake up the workers.
+    if (_threads == 1 || count <= grain)
+    {
+        this->PinCaller();
+        function(0, count, 0);
+        this->RestoreCaller();
+        return;
+    }
+
+    this->Dispatch(function, count, grain < 1 ? 1 : grain, false);
+}
+
+/** @fn WorkerPool::ParallelForStatic(int count, std::function<void(int, int, int)> function)
+ *  @brief Calls the function once per worker with the part [count * worker / threads, count * (worker + 1) / threads).
+ *
+ *  The same count gives every worker the same part in every call.
+ */
+void WorkerPool::ParallelForStatic(int count, std::function<void(int begin, int end, int worker)> function)
+{
+    if (count <= 0)
+    {
+        return;
+    }
+
+    if (_threads == 1)
+    {
+        this->PinCaller();
+        function(0, count, 0);
+        this->RestoreCaller();
+        return;
+    }
+
+    this->Dispatch(function, count, 1, true);
+}
+
+void WorkerPool::Dispatch(std::function<void(int begin, int end, int worker)> &function, int count, int grain,
+                          bool fixed_parts)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _function = function;
+        _count = count;
+        _grain = grain;
+        _fixed_parts = fixed_parts;
+        _next_index = 0;
+        _busy_workers = _threads - 1;
+        _job_generation++;
+    }
+
+    _start_condition.notify_all();
+
+    // The calling thread works as well.
+    this->PinCaller();
+    this->RunChunks(0);
+    this->RestoreCaller();
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _done_condition.wait(lock, [this] { return _busy_workers == 0; });
+}
+
+/** @fn WorkerPool::RunTasks(int count, std::function<void(int, int)> function)
+ *  @brief Calls the function for all tasks 0 ... count - 1 and returns after the last task is done.
+ *
+ *  The tasks are dealt out in blocks, so that each worker starts with neighbouring tasks.
+ */
+void WorkerPool::RunTasks(int count, std::function<void(int task, int worker)> function)
+{
+    for (int worker = 0; worker < _threads; worker++)
+    {
+        std::lock_guard<std::mutex> lock(_queues[worker]->mutex);
+
+        for (int task = (int) ((int64_t) count * worker / _threads);
+             task < (int) ((int64_t) count * (worker + 1) / _threads); task++)
+        {
+            _queues[worker]->tasks.push_back(task);
+        }
+    }
+
+    // One chunk per worker. A worker which gets no chunk only misses the chance to steal.
+    this->ParallelFor(_threads, 1, [&](int begin, int end, int worker)
+    {
+        int task;
+
+        while (this->PopTask(worker, task))
+        {
+            function(task, worker);
+        }
+    });
+}
+
+/** @fn WorkerPool::PopTask(int worker, int &task)
+ *  @brief Takes the newest task of the own queue or steals the oldest task of another queue.
+ */
+bool WorkerPool::PopTask(int worker, int &task)
+{
+    {
+        std::lock_guard<std::mutex> lock(_queues[worker]->mutex);
+
+        if (!_queues[worker]->tasks.empty())
+        {
+            task = _queues[worker]->tasks.back();
+            _queues[worker]->tasks.pop_back();
+            return true;
+        }
+    }
+
+    for (int i = 1; i < _threads; i++)
+    {
+        struct_task_queue &victim = *_queues[(worker + i) % _threads];
+
+        std::lock_guard<std::mutex> lock(victim.mutex);
+
+        if (!victim.tasks.empty())
+        {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** @fn WorkerPool::PinCaller()
+ *  @brief Pins the calling thread to the CPU of worker 0 for a job and keeps its own CPUs for RestoreCaller().
+ *
+ *  The caller can be the window thread or the thread of the frame pipeline. Either way, the part of worker 0 always
+ *  runs on the same CPU, where it was touched first, and the caller gets its CPUs back after the job.
+ */
+void WorkerPool::PinCaller()
+{
+    if (!_cpus.empty() && pthread_getaffinity_np(pthread_self(), sizeof _caller_cpus, &_caller_cpus) == 0)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(_cpus[0], &set);
+
+        pthread_setaffinity_np(pthread_self(), sizeof set, &set);
+    }
+}
+
+void WorkerPool::RestoreCaller()
+{
+    if (!_cpus.empty())
+    {
+        pthread_setaffinity_np(pthread_self(), sizeof _caller_cpus, &_caller_cpus);
+    }
+}
+
+void WorkerPool::RunChunks(int worker)
+{
+    if (_fixed_parts)
+    {
+        int begin = (int) ((int64_t) _count * worker / _threads);
+        int end = (int) ((int64_t) _count * (worker + 1) / _threads);
+
+        if (begin < end)
+        {
+            _function(begin, end, worker);
+        }
+
+        return;
+    }
+
+    while (true)
+    {
+        int begin = _next_index.fetch_add(_grain);
+
+        if (begin >= _count)
+        {
+            break;
+        }
+
+        int end = begin + _grain < _count ? begin + _grain : _count;
+
+        _function(begin, end, worker);
+    }
+}
+
+void WorkerPool::WorkerLoop(int worker)
+{
+    uint64_t seen_generation = 0;
+
+    if (!_cpus.empty())
+    {
+        PinThread(_cpus[worker]);
+    }
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _start_condition.wait(lock, [&] { return _shutdown || _job_generation != seen_generation; });
+
+            if (_shutdown)
+            {
+                return;
+            }
+
+            seen_generation = _job_generation;
+        }
+
+        this->RunChunks(worker);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _busy_workers--;
+        }
+
+        _done_condition.notify_one();
+    }
+}
+
+}